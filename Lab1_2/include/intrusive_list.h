@@ -0,0 +1,278 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+#include <type_traits>
+
+namespace my_cont {
+    template<typename T, typename Tag>
+    class IntrusiveList;
+
+    // Links embedded in the element itself. Derive from IntrusiveListHook<Tag> once per list the
+    // object should be able to join; distinct tags let one object sit in several lists.
+    // A hook unlinks itself when the object is destroyed, and copies of an object start unlinked.
+    template<typename Tag = void>
+    class IntrusiveListHook {
+    private:
+        IntrusiveListHook* prev = nullptr;
+        IntrusiveListHook* next = nullptr;
+
+        template<typename, typename>
+        friend class IntrusiveList;
+
+    public:
+        IntrusiveListHook() = default;
+
+        IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+
+        IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept {
+            return *this;
+        }
+
+        ~IntrusiveListHook() {
+            unlink();
+        }
+
+        [[nodiscard]] bool is_linked() const noexcept {
+            return next != nullptr;
+        }
+
+        // O(1) removal from whatever list the object is in; the list itself is not needed.
+        void unlink() noexcept {
+            if (next) {
+                prev->next = next;
+                next->prev = prev;
+                prev = nullptr;
+                next = nullptr;
+            }
+        }
+    };
+
+    // Doubly linked list over objects owned elsewhere: it never allocates, copies or destroys
+    // elements. The circular sentinel makes every link/unlink branch-free; size() is O(n)
+    // because elements may leave the list on their own.
+    template<typename T, typename Tag = void>
+    class IntrusiveList final {
+    private:
+        using hook_type = IntrusiveListHook<Tag>;
+        static_assert(std::is_base_of_v<hook_type, T>, "T must derive from IntrusiveListHook<Tag>");
+
+        hook_type root;
+
+        static hook_type* hook_of(T& value) noexcept {
+            return static_cast<hook_type*>(&value);
+        }
+
+        void reset_root() noexcept {
+            root.prev = &root;
+            root.next = &root;
+        }
+
+        static void link_before(hook_type* pos, hook_type* node) noexcept {
+            if (pos == node) {
+                return;
+            }
+            node->unlink();
+            node->prev = pos->prev;
+            node->next = pos;
+            pos->prev->next = node;
+            pos->prev = node;
+        }
+
+    public:
+        template <typename IterType>
+        class IntrusiveIterator {
+        private:
+            friend class IntrusiveList;
+            hook_type* current;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = std::remove_const_t<IterType>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
+
+            explicit IntrusiveIterator(hook_type* node = nullptr) : current(node) {}
+
+            template<typename Other>
+                requires (std::is_const_v<IterType> && !std::is_const_v<Other>)
+            IntrusiveIterator(const IntrusiveIterator<Other>& other) : current(other.current) {}
+
+            IterType& operator*() const { return static_cast<IterType&>(*current); }
+            IterType* operator->() const { return static_cast<IterType*>(current); }
+
+            IntrusiveIterator& operator++() {
+                current = current->next;
+                return *this;
+            }
+
+            IntrusiveIterator operator++(int) {
+                IntrusiveIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            IntrusiveIterator& operator--() {
+                current = current->prev;
+                return *this;
+            }
+
+            IntrusiveIterator operator--(int) {
+                IntrusiveIterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const IntrusiveIterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const IntrusiveIterator& other) const {
+                return !(*this == other);
+            }
+
+            template<typename U>
+            friend class IntrusiveIterator;
+        };
+
+        using iterator = IntrusiveIterator<T>;
+        using const_iterator = IntrusiveIterator<const T>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        IntrusiveList() noexcept {
+            reset_root();
+        }
+
+        IntrusiveList(const IntrusiveList&) = delete;
+        IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+        IntrusiveList(IntrusiveList&& other) noexcept {
+            reset_root();
+            swap(other);
+        }
+
+        IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~IntrusiveList() {
+            clear();
+        }
+
+        iterator begin() noexcept { return iterator(root.next); }
+        const_iterator begin() const noexcept { return const_iterator(root.next); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator(&root); }
+        const_iterator end() const noexcept { return const_iterator(const_cast<hook_type*>(&root)); }
+        const_iterator cend() const noexcept { return end(); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        // Iterator to an element known to be in this list, without searching.
+        iterator iterator_to(T& value) noexcept {
+            return iterator(hook_of(value));
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return root.next == &root; }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            std::size_t n = 0;
+            for (const hook_type* node = root.next; node != &root; node = node->next) {
+                ++n;
+            }
+            return n;
+        }
+
+        T& front() {
+            if (empty()) throw std::out_of_range("List is empty");
+            return static_cast<T&>(*root.next);
+        }
+
+        T& back() {
+            if (empty()) throw std::out_of_range("List is empty");
+            return static_cast<T&>(*root.prev);
+        }
+
+        // Linking an element that is already in a list moves it here.
+        iterator insert(const_iterator pos, T& value) noexcept {
+            link_before(pos.current, hook_of(value));
+            return iterator(hook_of(value));
+        }
+
+        void push_back(T& value) noexcept {
+            link_before(&root, hook_of(value));
+        }
+
+        void push_front(T& value) noexcept {
+            link_before(root.next, hook_of(value));
+        }
+
+        // Unlinks the element; it is not destroyed.
+        iterator erase(const_iterator pos) {
+            if (pos.current == &root) {
+                return end();
+            }
+            hook_type* next = pos.current->next;
+            pos.current->unlink();
+            return iterator(next);
+        }
+
+        void pop_back() {
+            if (empty()) throw std::out_of_range("List is empty");
+            root.prev->unlink();
+        }
+
+        void pop_front() {
+            if (empty()) throw std::out_of_range("List is empty");
+            root.next->unlink();
+        }
+
+        void clear() noexcept {
+            hook_type* node = root.next;
+            while (node != &root) {
+                hook_type* next = node->next;
+                node->prev = nullptr;
+                node->next = nullptr;
+                node = next;
+            }
+            reset_root();
+        }
+
+        void swap(IntrusiveList& other) noexcept {
+            bool mine = !empty();
+            bool theirs = !other.empty();
+            hook_type* my_first = root.next;
+            hook_type* my_last = root.prev;
+            if (theirs) {
+                root.next = other.root.next;
+                root.prev = other.root.prev;
+                root.next->prev = &root;
+                root.prev->next = &root;
+            } else {
+                reset_root();
+            }
+            if (mine) {
+                other.root.next = my_first;
+                other.root.prev = my_last;
+                my_first->prev = &other.root;
+                my_last->next = &other.root;
+            } else {
+                other.reset_root();
+            }
+        }
+    };
+}
+
+#endif // INTRUSIVE_LIST_H
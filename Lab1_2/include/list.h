@@ -5,7 +5,13 @@
 #include <stdexcept>
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <compare>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace my_cont {
     template<typename T>
@@ -20,8 +26,177 @@ namespace my_cont {
         [[nodiscard]] virtual std::size_t max_size() const = 0;
     };
 
-    template <typename T>
-    class List : public Container<T> {
+    // Fixed-size block pool: blocks are carved out of contiguous chunks and recycled
+    // through an intrusive free list. Not thread-safe; one pool per container.
+    class NodePool {
+    private:
+        struct Chunk {
+            Chunk* next;
+        };
+
+        std::size_t block_size = 0;
+        std::size_t block_align = alignof(std::max_align_t);
+        std::size_t blocks_per_chunk;
+        std::size_t live = 0;
+        std::size_t chunk_count = 0;
+        Chunk* chunks = nullptr;
+        void* free_list = nullptr;
+        char* bump = nullptr;
+        char* bump_end = nullptr;
+
+        static std::size_t round_up(std::size_t n, std::size_t align) {
+            return (n + align - 1) / align * align;
+        }
+
+        [[nodiscard]] std::size_t header_size() const {
+            return round_up(sizeof(Chunk), block_align);
+        }
+
+        void add_chunk() {
+            std::size_t bytes = header_size() + block_size * blocks_per_chunk;
+            auto* chunk = static_cast<Chunk*>(::operator new(bytes, std::align_val_t(block_align)));
+            chunk->next = chunks;
+            chunks = chunk;
+            ++chunk_count;
+            bump = reinterpret_cast<char*>(chunk) + header_size();
+            bump_end = bump + block_size * blocks_per_chunk;
+        }
+
+    public:
+        explicit NodePool(std::size_t blocks_per_chunk = 256) : blocks_per_chunk(std::max<std::size_t>(blocks_per_chunk, 1)) {}
+
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        ~NodePool() {
+            release();
+        }
+
+        // The first request fixes the block size; later requests that don't fit go to the heap.
+        [[nodiscard]] bool fits(std::size_t size, std::size_t align) {
+            if (block_size == 0) {
+                block_align = std::max(align, alignof(void*));
+                block_size = round_up(std::max(size, sizeof(void*)), block_align);
+            }
+            return size <= block_size && align <= block_align;
+        }
+
+        void* allocate() {
+            void* block;
+            if (free_list) {
+                block = free_list;
+                free_list = *static_cast<void**>(free_list);
+            } else {
+                if (bump == bump_end) {
+                    add_chunk();
+                }
+                block = bump;
+                bump += block_size;
+            }
+            ++live;
+            return block;
+        }
+
+        void deallocate(void* block) noexcept {
+            *static_cast<void**>(block) = free_list;
+            free_list = block;
+            --live;
+        }
+
+        [[nodiscard]] std::size_t live_blocks() const noexcept {
+            return live;
+        }
+
+        [[nodiscard]] std::size_t chunks_allocated() const noexcept {
+            return chunk_count;
+        }
+
+        // Frees every chunk at once. Only valid when no block is in use any more.
+        void release() noexcept {
+            while (chunks) {
+                Chunk* next = chunks->next;
+                ::operator delete(chunks, std::align_val_t(block_align));
+                chunks = next;
+            }
+            chunk_count = 0;
+            live = 0;
+            free_list = nullptr;
+            bump = bump_end = nullptr;
+        }
+    };
+
+    // Allocator over a shared NodePool. Rebound copies share the pool, so List<T, PoolAllocator<T>>
+    // takes its nodes from it; copying a container gives the copy a pool of its own.
+    template<typename T>
+    class PoolAllocator {
+    private:
+        template<typename U>
+        friend class PoolAllocator;
+
+        std::shared_ptr<NodePool> pool;
+        std::size_t blocks_per_chunk;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        explicit PoolAllocator(std::size_t blocks_per_chunk = 256)
+            : pool(std::make_shared<NodePool>(blocks_per_chunk)), blocks_per_chunk(blocks_per_chunk) {}
+
+        // No move members on purpose: moving must copy the pool pointer, otherwise a
+        // moved-from container would be left with an allocator that has no pool.
+        PoolAllocator(const PoolAllocator&) noexcept = default;
+        PoolAllocator& operator=(const PoolAllocator&) noexcept = default;
+
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept
+            : pool(other.pool), blocks_per_chunk(other.blocks_per_chunk) {}
+
+        T* allocate(std::size_t n) {
+            if (n == 1 && pool->fits(sizeof(T), alignof(T))) {
+                return static_cast<T*>(pool->allocate());
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept {
+            if (n == 1 && pool->fits(sizeof(T), alignof(T))) {
+                pool->deallocate(p);
+            } else {
+                std::allocator<T>().deallocate(p, n);
+            }
+        }
+
+        [[nodiscard]] PoolAllocator select_on_container_copy_construction() const {
+            return PoolAllocator(blocks_per_chunk);
+        }
+
+        // Lets a container that is about to drop `count` pooled blocks free whole chunks instead,
+        // provided nobody else holds blocks from the same pool.
+        [[nodiscard]] bool owns_only(std::size_t count) const noexcept {
+            return pool->live_blocks() == count;
+        }
+
+        void release() noexcept {
+            pool->release();
+        }
+
+        [[nodiscard]] const NodePool& resource() const noexcept {
+            return *pool;
+        }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U>& other) const noexcept {
+            return pool == other.pool;
+        }
+    };
+
+    // List is deliberately non-virtual and final so every call can be inlined;
+    // wrap it in PolymorphicList when a runtime interface is needed.
+    template <typename T, typename Allocator = std::allocator<T>>
+    class List final {
     private:
         class Node {
         protected:
@@ -29,29 +204,102 @@ namespace my_cont {
             Node* prev;
             Node* next;
 
-            explicit Node(const T& val, Node* p = nullptr, Node* n = nullptr)
-                : data(val), prev(p), next(n) {}
+            template<typename... Args>
+            explicit Node(Node* p, Node* n, Args&&... args)
+                : data(std::forward<Args>(args)...), prev(p), next(n) {}
 
             friend class List;
         };
 
+        using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
         Node* head;
         Node* tail;
         std::size_t cap;
+        [[no_unique_address]] node_allocator node_alloc;
+
+        template<typename... Args>
+        Node* create_node(Node* p, Node* n, Args&&... args) {
+            Node* node = node_traits::allocate(node_alloc, 1);
+            try {
+                ::new (static_cast<void*>(node)) Node(p, n, std::forward<Args>(args)...);
+            } catch (...) {
+                node_traits::deallocate(node_alloc, node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(Node* node) {
+            node->~Node();
+            node_traits::deallocate(node_alloc, node, 1);
+        }
+
+        // Detaches [first, last] (both inclusive) from the chain.
+        void unlink_nodes(Node* first, Node* last) noexcept {
+            if (first->prev) {
+                first->prev->next = last->next;
+            } else {
+                head = last->next;
+            }
+            if (last->next) {
+                last->next->prev = first->prev;
+            } else {
+                tail = first->prev;
+            }
+            first->prev = nullptr;
+            last->next = nullptr;
+        }
+
+        // Links the chain [first, last] in front of pos (nullptr means at the end).
+        void link_nodes(Node* pos, Node* first, Node* last) noexcept {
+            Node* before = pos ? pos->prev : tail;
+            first->prev = before;
+            last->next = pos;
+            if (before) {
+                before->next = first;
+            } else {
+                head = first;
+            }
+            if (pos) {
+                pos->prev = last;
+            } else {
+                tail = last;
+            }
+        }
+
+        void steal(List& other) noexcept {
+            head = other.head;
+            tail = other.tail;
+            cap = other.cap;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.cap = 0;
+        }
 
     public:
-        template <typename IterType>
+        // Checked iterators throw when dereferencing end(); unchecked ones skip the test
+        // so tight loops compile down to plain pointer chasing.
+        template <typename IterType, bool Checked = true>
         class ListIterator {
         private:
             friend class List;
             Node* current;
 
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = std::remove_const_t<IterType>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
 
             explicit ListIterator(Node* node = nullptr) : current(node) {}
 
             IterType& operator*() const {
-                if (!current) throw std::out_of_range("Dereferencing null iterator");
+                if constexpr (Checked) {
+                    if (!current) throw std::out_of_range("Dereferencing null iterator");
+                }
                 return current->data;
             }
             IterType* operator->() const { return &current->data; }
@@ -104,6 +352,11 @@ namespace my_cont {
             friend class List;
             Node* current;
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = std::remove_const_t<IterType>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
 
             explicit ListReverseIterator(Node* node = nullptr) : current(node) {}
 
@@ -148,35 +401,56 @@ namespace my_cont {
         using const_iterator = ListIterator<const T>;
         using reverse_iterator = ListReverseIterator<T>;
         using const_reverse_iterator = ListReverseIterator<const T>;
+        using unchecked_iterator = ListIterator<T, false>;
+        using unchecked_const_iterator = ListIterator<const T, false>;
 
-        List() : head(nullptr), tail(nullptr), cap(0) {}
+        template <typename Iter>
+        class Range {
+        private:
+            Iter first;
+            Iter last;
 
-        List(std::initializer_list<T> init) : List() {
+        public:
+            Range(Iter first, Iter last) : first(first), last(last) {}
+
+            Iter begin() const { return first; }
+            Iter end() const { return last; }
+        };
+
+        using allocator_type = Allocator;
+
+        List() : List(Allocator()) {}
+
+        explicit List(const Allocator& alloc) : head(nullptr), tail(nullptr), cap(0), node_alloc(alloc) {}
+
+        List(std::initializer_list<T> init, const Allocator& alloc = Allocator()) : List(alloc) {
             for (const auto& val : init) {
                 push_back(val);
             }
         }
 
-        List(const List& other) : List() {
+        List(const List& other)
+            : List(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {
             for (const auto& val : other) {
                 push_back(val);
             }
         }
 
         List(List&& other) noexcept
-            : head(other.head), tail(other.tail), cap(other.cap) {
-            other.head = nullptr;
-            other.tail = nullptr;
-            other.cap = 0;
+            : head(nullptr), tail(nullptr), cap(0), node_alloc(std::move(other.node_alloc)) {
+            steal(other);
         }
 
-        ~List() override {
-            List<T>::clear();
+        ~List() {
+            clear();
         }
 
         List& operator=(const List& other) {
             if (this != &other) {
                 clear();
+                if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+                    node_alloc = other.node_alloc;
+                }
                 for (const auto& val : other) {
                     push_back(val);
                 }
@@ -184,66 +458,96 @@ namespace my_cont {
             return *this;
         }
 
-        List& operator=(List&& other) noexcept {
+        List& operator=(List&& other) noexcept(node_traits::propagate_on_container_move_assignment::value ||
+                                               node_traits::is_always_equal::value) {
             if (this != &other) {
                 clear();
-                head = other.head;
-                tail = other.tail;
-                cap = other.cap;
-                other.head = nullptr;
-                other.tail = nullptr;
-                other.cap = 0;
+                if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+                    node_alloc = std::move(other.node_alloc);
+                    steal(other);
+                } else if (node_alloc == other.node_alloc) {
+                    steal(other);
+                } else {
+                    for (auto& val : other) {
+                        push_back(std::move(val));
+                    }
+                    other.clear();
+                }
             }
             return *this;
         }
 
-        virtual iterator begin() const { return iterator(head); }
-        virtual const_iterator cbegin() const { return const_iterator(head); }
+        [[nodiscard]] allocator_type get_allocator() const noexcept {
+            return allocator_type(node_alloc);
+        }
+
+        iterator begin() const { return iterator(head); }
+        const_iterator cbegin() const { return const_iterator(head); }
 
-        virtual iterator end() const { return iterator(nullptr); }
-        virtual const_iterator cend() const { return const_iterator(nullptr); }
+        iterator end() const { return iterator(nullptr); }
+        const_iterator cend() const { return const_iterator(nullptr); }
 
-        virtual reverse_iterator rbegin() const { return reverse_iterator(tail); }
-        virtual const_reverse_iterator crbegin() const { return const_reverse_iterator(tail); }
+        reverse_iterator rbegin() const { return reverse_iterator(tail); }
+        const_reverse_iterator crbegin() const { return const_reverse_iterator(tail); }
 
-        virtual reverse_iterator rend() const { return reverse_iterator(nullptr); }
-        virtual const_reverse_iterator crend() const { return const_reverse_iterator(nullptr); }
+        reverse_iterator rend() const { return reverse_iterator(nullptr); }
+        const_reverse_iterator crend() const { return const_reverse_iterator(nullptr); }
 
-        [[nodiscard]] bool empty() const override { return cap == 0; }
-        [[nodiscard]] std::size_t size() const override { return cap; }
-        [[nodiscard]] std::size_t max_size() const override { return cap; }
+        // Iteration without the end() check on every dereference.
+        Range<unchecked_iterator> unchecked() { return {unchecked_iterator(head), unchecked_iterator(nullptr)}; }
+        Range<unchecked_const_iterator> unchecked() const {
+            return {unchecked_const_iterator(head), unchecked_const_iterator(nullptr)};
+        }
+
+        [[nodiscard]] bool empty() const { return cap == 0; }
+        [[nodiscard]] std::size_t size() const { return cap; }
+        [[nodiscard]] std::size_t max_size() const { return cap; }
 
-        virtual T& front() {
+        T& front() {
             if (empty() || !head) throw std::out_of_range("List is empty");
             return head->data;
         }
 
-        virtual T& back() {
+        T& back() {
             if (empty()) throw std::out_of_range("List is empty");
             return tail->data;
         }
 
-        virtual void clear() {
+        void clear() {
+            bool whole_pool = false;
+            if constexpr (requires { node_alloc.owns_only(cap); node_alloc.release(); }) {
+                whole_pool = cap != 0 && node_alloc.owns_only(cap);
+            }
             while (head) {
                 Node* temp = head;
                 head = head->next;
-                delete temp;
+                if (whole_pool) {
+                    temp->~Node();
+                } else {
+                    destroy_node(temp);
+                }
+            }
+            if (whole_pool) {
+                if constexpr (requires { node_alloc.release(); }) {
+                    node_alloc.release();
+                }
             }
             tail = nullptr;
             cap = 0;
         }
 
-        virtual iterator insert(iterator pos, const T& value) {
+        template<typename... Args>
+        iterator emplace(iterator pos, Args&&... args) {
             if (pos == end()) {
-                push_back(value);
+                emplace_back(std::forward<Args>(args)...);
                 return iterator(tail);
             }
             else if (pos == begin()) {
-                push_front(value);
+                emplace_front(std::forward<Args>(args)...);
                 return begin();
             }
             else {
-                Node* newNode = new Node(value, pos.current->prev, pos.current);
+                Node* newNode = create_node(pos.current->prev, pos.current, std::forward<Args>(args)...);
                 pos.current->prev->next = newNode;
                 pos.current->prev = newNode;
                 ++cap;
@@ -251,7 +555,15 @@ namespace my_cont {
             }
         }
 
-        virtual iterator erase(iterator pos) {
+        iterator insert(iterator pos, const T& value) {
+            return emplace(pos, value);
+        }
+
+        iterator insert(iterator pos, T&& value) {
+            return emplace(pos, std::move(value));
+        }
+
+        iterator erase(iterator pos) {
             if (pos == end() || empty()) {
                 return end();
             }
@@ -273,14 +585,15 @@ namespace my_cont {
                 tail = toDelete->prev;
             }
 
-            delete toDelete;
+            destroy_node(toDelete);
             --cap;
             return nextIter;
         }
 
 
-        virtual void push_back(const T& value) {
-            Node* newNode = new Node(value, tail, nullptr);
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
+            Node* newNode = create_node(tail, nullptr, std::forward<Args>(args)...);
             if (tail) {
                 tail->next = newNode;
             } else {
@@ -288,9 +601,18 @@ namespace my_cont {
             }
             tail = newNode;
             ++cap;
+            return newNode->data;
         }
 
-        virtual void pop_back() {
+        void push_back(const T& value) {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value) {
+            emplace_back(std::move(value));
+        }
+
+        void pop_back() {
             if (empty()) throw std::out_of_range("List is empty");
 
             Node* to_delete = tail;
@@ -300,12 +622,13 @@ namespace my_cont {
             } else {
                 head = nullptr;
             }
-            delete to_delete;
+            destroy_node(to_delete);
             --cap;
         }
 
-        virtual void push_front(const T& value) {
-            Node* new_node = new Node(value, nullptr, head);
+        template<typename... Args>
+        T& emplace_front(Args&&... args) {
+            Node* new_node = create_node(nullptr, head, std::forward<Args>(args)...);
             if (head) {
                 head->prev = new_node;
             } else {
@@ -313,9 +636,18 @@ namespace my_cont {
             }
             head = new_node;
             ++cap;
+            return new_node->data;
+        }
+
+        void push_front(const T& value) {
+            emplace_front(value);
         }
 
-        virtual void pop_front() {
+        void push_front(T&& value) {
+            emplace_front(std::move(value));
+        }
+
+        void pop_front() {
             if (empty()) throw std::out_of_range("List is empty");
 
             Node* to_delete = head;
@@ -325,11 +657,20 @@ namespace my_cont {
             } else {
                 tail = nullptr;
             }
-            delete to_delete;
+            destroy_node(to_delete);
             --cap;
         }
 
-        virtual void resize(std::size_t count, T val) {
+        void resize(std::size_t count) {
+            while (cap > count) {
+                pop_back();
+            }
+            while (cap < count) {
+                emplace_back();
+            }
+        }
+
+        void resize(std::size_t count, const T& val) {
             while (cap > count) {
                 pop_back();
             }
@@ -338,12 +679,273 @@ namespace my_cont {
             }
         }
 
-        virtual void swap(List& other) noexcept {
+        void swap(List& other) noexcept {
+            if constexpr (node_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(node_alloc, other.node_alloc);
+            }
             std::swap(head, other.head);
             std::swap(tail, other.tail);
             std::swap(cap, other.cap);
         }
 
+        // Moves all of other's nodes in front of pos without copying or allocating. Nodes owned
+        // by an unequal allocator can't be relinked; their elements are moved into new nodes.
+        void splice(iterator pos, List& other) {
+            if (&other == this || other.empty()) {
+                return;
+            }
+            if constexpr (!node_traits::is_always_equal::value) {
+                if (!(node_alloc == other.node_alloc)) {
+                    for (auto& val : other) {
+                        insert(pos, std::move(val));
+                    }
+                    other.clear();
+                    return;
+                }
+            }
+            Node* first = other.head;
+            Node* last = other.tail;
+            std::size_t count = other.cap;
+            other.head = other.tail = nullptr;
+            other.cap = 0;
+            link_nodes(pos.current, first, last);
+            cap += count;
+        }
+
+        void splice(iterator pos, List&& other) {
+            splice(pos, other);
+        }
+
+        // Moves the single node at it from other in front of pos.
+        void splice(iterator pos, List& other, iterator it) {
+            Node* node = it.current;
+            if (!node || (&other == this && (node == pos.current || node->next == pos.current))) {
+                return;
+            }
+            if constexpr (!node_traits::is_always_equal::value) {
+                if (&other != this && !(node_alloc == other.node_alloc)) {
+                    insert(pos, std::move(node->data));
+                    other.erase(it);
+                    return;
+                }
+            }
+            other.unlink_nodes(node, node);
+            link_nodes(pos.current, node, node);
+            --other.cap;
+            ++cap;
+        }
+
+        void splice(iterator pos, List&& other, iterator it) {
+            splice(pos, other, it);
+        }
+
+        // Moves [first, last) from other in front of pos. Splicing from another list counts the
+        // range, so it is linear in its length; within one list it is O(1).
+        void splice(iterator pos, List& other, iterator first, iterator last) {
+            if (first == last) {
+                return;
+            }
+            if constexpr (!node_traits::is_always_equal::value) {
+                if (&other != this && !(node_alloc == other.node_alloc)) {
+                    while (first != last) {
+                        insert(pos, std::move(*first));
+                        first = other.erase(first);
+                    }
+                    return;
+                }
+            }
+            Node* first_node = first.current;
+            Node* last_node = last.current ? last.current->prev : other.tail;
+            if (&other != this) {
+                std::size_t count = 1;
+                for (Node* n = first_node; n != last_node; n = n->next) {
+                    ++count;
+                }
+                other.cap -= count;
+                cap += count;
+            }
+            other.unlink_nodes(first_node, last_node);
+            link_nodes(pos.current, first_node, last_node);
+        }
+
+        void splice(iterator pos, List&& other, iterator first, iterator last) {
+            splice(pos, other, first, last);
+        }
+
+        // Merges sorted other into this sorted list by relinking; stable, this list wins ties.
+        template<typename Compare = std::less<>>
+        void merge(List& other, Compare comp = {}) {
+            if (&other == this || other.empty()) {
+                return;
+            }
+            if constexpr (!node_traits::is_always_equal::value) {
+                if (!(node_alloc == other.node_alloc)) {
+                    List moved(get_allocator());
+                    moved.splice(moved.end(), other);
+                    merge(moved, comp);
+                    return;
+                }
+            }
+            Node* a = head;
+            Node* b = other.head;
+            while (a && b) {
+                if (comp(b->data, a->data)) {
+                    Node* run_end = b;
+                    while (run_end->next && comp(run_end->next->data, a->data)) {
+                        run_end = run_end->next;
+                    }
+                    Node* next_b = run_end->next;
+                    link_nodes(a, b, run_end);
+                    b = next_b;
+                } else {
+                    a = a->next;
+                }
+            }
+            if (b) {
+                link_nodes(nullptr, b, other.tail);
+            }
+            cap += other.cap;
+            other.head = other.tail = nullptr;
+            other.cap = 0;
+        }
+
+        template<typename Compare = std::less<>>
+        void merge(List&& other, Compare comp = {}) {
+            merge(other, comp);
+        }
+
+        // Stable bottom-up merge sort over the nodes; O(n log n), no allocation, iterators stay valid.
+        template<typename Compare = std::less<>>
+        void sort(Compare comp = {}) {
+            if (cap < 2) {
+                return;
+            }
+            Node* list = head;
+            for (std::size_t width = 1;; width *= 2) {
+                Node* merged_head = nullptr;
+                Node* merged_tail = nullptr;
+                std::size_t merges = 0;
+                Node* p = list;
+                while (p) {
+                    ++merges;
+                    Node* q = p;
+                    std::size_t p_size = 0;
+                    while (q && p_size < width) {
+                        q = q->next;
+                        ++p_size;
+                    }
+                    std::size_t q_size = width;
+                    while (p_size > 0 || (q_size > 0 && q)) {
+                        Node* take;
+                        if (p_size == 0) {
+                            take = q;
+                            q = q->next;
+                            --q_size;
+                        } else if (q_size == 0 || !q || !comp(q->data, p->data)) {
+                            take = p;
+                            p = p->next;
+                            --p_size;
+                        } else {
+                            take = q;
+                            q = q->next;
+                            --q_size;
+                        }
+                        if (merged_tail) {
+                            merged_tail->next = take;
+                        } else {
+                            merged_head = take;
+                        }
+                        merged_tail = take;
+                    }
+                    p = q;
+                }
+                merged_tail->next = nullptr;
+                list = merged_head;
+                if (merges <= 1) {
+                    break;
+                }
+            }
+            head = list;
+            Node* prev = nullptr;
+            for (Node* n = head; n; n = n->next) {
+                n->prev = prev;
+                prev = n;
+            }
+            tail = prev;
+        }
+
+        // Removes consecutive equivalent elements; returns how many were removed.
+        template<typename BinaryPredicate = std::equal_to<>>
+        std::size_t unique(BinaryPredicate pred = {}) {
+            std::size_t removed = 0;
+            if (!head) {
+                return removed;
+            }
+            Node* kept = head;
+            while (kept->next) {
+                if (pred(kept->data, kept->next->data)) {
+                    Node* dup = kept->next;
+                    unlink_nodes(dup, dup);
+                    destroy_node(dup);
+                    --cap;
+                    ++removed;
+                } else {
+                    kept = kept->next;
+                }
+            }
+            return removed;
+        }
+
+        template<typename Predicate>
+        std::size_t remove_if(Predicate pred) {
+            std::size_t removed = 0;
+            Node* node = head;
+            while (node) {
+                Node* next = node->next;
+                if (pred(node->data)) {
+                    unlink_nodes(node, node);
+                    destroy_node(node);
+                    --cap;
+                    ++removed;
+                }
+                node = next;
+            }
+            return removed;
+        }
+
+        std::size_t remove(const T& value) {
+            // value may live in one of the removed nodes; that node is freed last.
+            Node* deferred = nullptr;
+            std::size_t removed = 0;
+            Node* node = head;
+            while (node) {
+                Node* next = node->next;
+                if (node->data == value) {
+                    unlink_nodes(node, node);
+                    --cap;
+                    ++removed;
+                    if (&node->data == &value) {
+                        deferred = node;
+                    } else {
+                        destroy_node(node);
+                    }
+                }
+                node = next;
+            }
+            if (deferred) {
+                destroy_node(deferred);
+            }
+            return removed;
+        }
+
+        void reverse() noexcept {
+            for (Node* node = head; node; node = node->prev) {
+                std::swap(node->prev, node->next);
+            }
+            std::swap(head, tail);
+        }
+
         bool operator==(const List& other) const {
             if (cap != other.cap) return false;
 
@@ -406,6 +1008,50 @@ namespace my_cont {
         }
 
     };
+
+    // Opt-in runtime interface for code that has to treat different sequences uniformly.
+    template<typename T>
+    class SequenceContainer : public Container<T> {
+    public:
+        virtual T& front() = 0;
+        virtual T& back() = 0;
+        virtual void push_back(const T& value) = 0;
+        virtual void push_front(const T& value) = 0;
+        virtual void pop_back() = 0;
+        virtual void pop_front() = 0;
+        virtual void clear() = 0;
+    };
+
+    template<typename T, typename Impl = List<T>>
+    class PolymorphicList final : public SequenceContainer<T> {
+    private:
+        Impl impl;
+
+    public:
+        PolymorphicList() = default;
+
+        PolymorphicList(std::initializer_list<T> init) : impl(init) {}
+
+        explicit PolymorphicList(Impl list) : impl(std::move(list)) {}
+
+        Impl& get() noexcept { return impl; }
+        const Impl& get() const noexcept { return impl; }
+
+        [[nodiscard]] bool empty() const override { return impl.empty(); }
+        [[nodiscard]] std::size_t size() const override { return impl.size(); }
+        [[nodiscard]] std::size_t max_size() const override { return impl.max_size(); }
+
+        T& front() override { return impl.front(); }
+        T& back() override { return impl.back(); }
+        void push_back(const T& value) override { impl.push_back(value); }
+        void push_front(const T& value) override { impl.push_front(value); }
+        void pop_back() override { impl.pop_back(); }
+        void pop_front() override { impl.pop_front(); }
+        void clear() override { impl.clear(); }
+    };
+
+    template<typename T>
+    using PooledList = List<T, PoolAllocator<T>>;
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,425 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include <initializer_list>
+#include <compare>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace my_cont {
+    // Picks enough elements to make a node about four cache lines long.
+    template<typename T>
+    constexpr std::size_t unrolled_node_capacity() {
+        constexpr std::size_t budget = 256 - 2 * sizeof(void*) - sizeof(std::size_t);
+        return std::max<std::size_t>(4, budget / sizeof(T));
+    }
+
+    // Doubly linked list of small arrays. Offers the same iterator, insert and erase interface
+    // as List, but a traversal touches one node per N elements. Inserting into a full node
+    // splits it in half; erasing merges a nearly empty node with its successor.
+    // Iterators are invalidated by any insert or erase in the node they point into.
+    template<typename T, std::size_t N = unrolled_node_capacity<T>()>
+    class UnrolledList final {
+        static_assert(N >= 2, "UnrolledList needs at least two elements per node");
+
+    private:
+        struct Node {
+            Node* prev = nullptr;
+            Node* next = nullptr;
+            std::size_t count = 0;
+            alignas(T) unsigned char storage[N * sizeof(T)];
+
+            T* items() noexcept {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+
+            T& operator[](std::size_t i) noexcept {
+                return items()[i];
+            }
+
+            [[nodiscard]] bool full() const noexcept {
+                return count == N;
+            }
+
+            // Constructs a new element at idx, shifting [idx, count) right by one.
+            template<typename... Args>
+            void insert_at(std::size_t idx, Args&&... args) {
+                T* data = items();
+                if (idx == count) {
+                    ::new (static_cast<void*>(data + count)) T(std::forward<Args>(args)...);
+                } else {
+                    T tmp(std::forward<Args>(args)...);
+                    ::new (static_cast<void*>(data + count)) T(std::move(data[count - 1]));
+                    std::move_backward(data + idx, data + count - 1, data + count);
+                    data[idx] = std::move(tmp);
+                }
+                ++count;
+            }
+
+            void erase_at(std::size_t idx) {
+                T* data = items();
+                std::move(data + idx + 1, data + count, data + idx);
+                --count;
+                std::destroy_at(data + count);
+            }
+
+            // Moves [from, count) to the end of dst.
+            void move_tail_to(std::size_t from, Node* dst) {
+                T* data = items();
+                std::uninitialized_move(data + from, data + count, dst->items() + dst->count);
+                std::destroy(data + from, data + count);
+                dst->count += count - from;
+                count = from;
+            }
+
+            void destroy_all() noexcept {
+                std::destroy(items(), items() + count);
+                count = 0;
+            }
+        };
+
+        Node* head = nullptr;
+        Node* tail = nullptr;
+        std::size_t cap = 0;
+
+        Node* link_after(Node* node) {
+            Node* fresh = new Node;
+            fresh->prev = node;
+            if (node) {
+                fresh->next = node->next;
+                node->next = fresh;
+            } else {
+                fresh->next = head;
+                head = fresh;
+            }
+            if (fresh->next) {
+                fresh->next->prev = fresh;
+            } else {
+                tail = fresh;
+            }
+            return fresh;
+        }
+
+        void unlink(Node* node) noexcept {
+            if (node->prev) {
+                node->prev->next = node->next;
+            } else {
+                head = node->next;
+            }
+            if (node->next) {
+                node->next->prev = node->prev;
+            } else {
+                tail = node->prev;
+            }
+            delete node;
+        }
+
+        // Splits a full node in half; returns the new right half.
+        Node* split(Node* node) {
+            Node* right = link_after(node);
+            node->move_tail_to(N / 2, right);
+            return right;
+        }
+
+    public:
+        template <typename IterType>
+        class UnrolledIterator {
+        private:
+            friend class UnrolledList;
+            using owner_type = std::conditional_t<std::is_const_v<IterType>, const UnrolledList, UnrolledList>;
+
+            owner_type* owner = nullptr;
+            Node* node = nullptr;
+            std::size_t idx = 0;
+
+            UnrolledIterator(owner_type* owner, Node* node, std::size_t idx) : owner(owner), node(node), idx(idx) {}
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = std::remove_const_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
+
+            UnrolledIterator() = default;
+
+            template<typename Other>
+                requires (std::is_const_v<IterType> && !std::is_const_v<Other>)
+            UnrolledIterator(const UnrolledIterator<Other>& other) : owner(other.owner), node(other.node), idx(other.idx) {}
+
+            IterType& operator*() const {
+                if (!node) throw std::out_of_range("Dereferencing null iterator");
+                return (*node)[idx];
+            }
+
+            IterType* operator->() const { return &(*node)[idx]; }
+
+            UnrolledIterator& operator++() {
+                if (++idx == node->count) {
+                    node = node->next;
+                    idx = 0;
+                }
+                return *this;
+            }
+
+            UnrolledIterator operator++(int) {
+                UnrolledIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            UnrolledIterator& operator--() {
+                if (!node) {
+                    node = owner->tail;
+                    idx = node->count - 1;
+                } else if (idx == 0) {
+                    node = node->prev;
+                    idx = node->count - 1;
+                } else {
+                    --idx;
+                }
+                return *this;
+            }
+
+            UnrolledIterator operator--(int) {
+                UnrolledIterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const UnrolledIterator& other) const {
+                return node == other.node && idx == other.idx;
+            }
+
+            bool operator!=(const UnrolledIterator& other) const {
+                return !(*this == other);
+            }
+
+            template<typename U>
+            friend class UnrolledIterator;
+        };
+
+        using iterator = UnrolledIterator<T>;
+        using const_iterator = UnrolledIterator<const T>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr std::size_t node_capacity = N;
+
+        UnrolledList() = default;
+
+        UnrolledList(std::initializer_list<T> init) {
+            for (const auto& val : init) {
+                push_back(val);
+            }
+        }
+
+        UnrolledList(const UnrolledList& other) {
+            for (const auto& val : other) {
+                push_back(val);
+            }
+        }
+
+        UnrolledList(UnrolledList&& other) noexcept
+            : head(std::exchange(other.head, nullptr)), tail(std::exchange(other.tail, nullptr)),
+              cap(std::exchange(other.cap, 0)) {}
+
+        ~UnrolledList() {
+            clear();
+        }
+
+        UnrolledList& operator=(const UnrolledList& other) {
+            if (this != &other) {
+                UnrolledList copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        UnrolledList& operator=(UnrolledList&& other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        iterator begin() { return iterator(this, head, 0); }
+        const_iterator begin() const { return const_iterator(this, head, 0); }
+        const_iterator cbegin() const { return begin(); }
+
+        iterator end() { return iterator(this, nullptr, 0); }
+        const_iterator end() const { return const_iterator(this, nullptr, 0); }
+        const_iterator cend() const { return end(); }
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const { return rbegin(); }
+
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const { return rend(); }
+
+        [[nodiscard]] bool empty() const { return cap == 0; }
+        [[nodiscard]] std::size_t size() const { return cap; }
+        [[nodiscard]] std::size_t max_size() const { return cap; }
+
+        T& front() {
+            if (empty()) throw std::out_of_range("List is empty");
+            return (*head)[0];
+        }
+
+        T& back() {
+            if (empty()) throw std::out_of_range("List is empty");
+            return (*tail)[tail->count - 1];
+        }
+
+        void clear() {
+            while (head) {
+                Node* next = head->next;
+                head->destroy_all();
+                delete head;
+                head = next;
+            }
+            tail = nullptr;
+            cap = 0;
+        }
+
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args) {
+            Node* node = pos.node;
+            std::size_t idx = pos.idx;
+            if (!node && (!tail || tail->full())) {
+                Node* fresh = link_after(tail);
+                try {
+                    fresh->insert_at(0, std::forward<Args>(args)...);
+                } catch (...) {
+                    unlink(fresh);
+                    throw;
+                }
+                ++cap;
+                return iterator(this, fresh, 0);
+            }
+            if (!node) {
+                node = tail;
+                idx = node->count;
+            } else if (node->full()) {
+                // Build the value first: the arguments may refer to elements the split moves.
+                T tmp(std::forward<Args>(args)...);
+                Node* right = split(node);
+                if (idx > node->count) {
+                    idx -= node->count;
+                    node = right;
+                }
+                node->insert_at(idx, std::move(tmp));
+                ++cap;
+                return iterator(this, node, idx);
+            }
+            node->insert_at(idx, std::forward<Args>(args)...);
+            ++cap;
+            return iterator(this, node, idx);
+        }
+
+        iterator insert(const_iterator pos, const T& value) {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T&& value) {
+            return emplace(pos, std::move(value));
+        }
+
+        iterator erase(const_iterator pos) {
+            Node* node = pos.node;
+            if (!node || empty()) {
+                return end();
+            }
+            std::size_t idx = pos.idx;
+            node->erase_at(idx);
+            --cap;
+            if (node->count == 0) {
+                Node* next = node->next;
+                unlink(node);
+                return iterator(this, next, 0);
+            }
+            if (node->next && node->count < N / 4 && node->count + node->next->count <= N) {
+                Node* next = node->next;
+                next->move_tail_to(0, node);
+                unlink(next);
+            }
+            if (idx == node->count) {
+                return iterator(this, node->next, 0);
+            }
+            return iterator(this, node, idx);
+        }
+
+        void push_back(const T& value) {
+            emplace(cend(), value);
+        }
+
+        void push_back(T&& value) {
+            emplace(cend(), std::move(value));
+        }
+
+        void pop_back() {
+            if (empty()) throw std::out_of_range("List is empty");
+            erase(const_iterator(this, tail, tail->count - 1));
+        }
+
+        void push_front(const T& value) {
+            emplace(cbegin(), value);
+        }
+
+        void push_front(T&& value) {
+            emplace(cbegin(), std::move(value));
+        }
+
+        void pop_front() {
+            if (empty()) throw std::out_of_range("List is empty");
+            erase(cbegin());
+        }
+
+        void resize(std::size_t count, T val) {
+            while (cap > count) {
+                pop_back();
+            }
+            while (cap < count) {
+                push_back(val);
+            }
+        }
+
+        void swap(UnrolledList& other) noexcept {
+            std::swap(head, other.head);
+            std::swap(tail, other.tail);
+            std::swap(cap, other.cap);
+        }
+
+        // Number of allocated nodes; useful for checking memory overhead.
+        [[nodiscard]] std::size_t node_count() const noexcept {
+            std::size_t n = 0;
+            for (Node* node = head; node; node = node->next) {
+                ++n;
+            }
+            return n;
+        }
+
+        bool operator==(const UnrolledList& other) const {
+            return cap == other.cap && std::equal(begin(), end(), other.begin());
+        }
+
+        bool operator!=(const UnrolledList& other) const {
+            return !(*this == other);
+        }
+
+        auto operator<=>(const UnrolledList& other) const {
+            return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+        }
+    };
+}
+
+#endif // UNROLLED_LIST_H
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "intrusive_list.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace my_cont;
+
+struct ByAge {};
+
+struct Connection : IntrusiveListHook<>, IntrusiveListHook<ByAge> {
+    int id;
+    std::string peer;
+
+    Connection(int id, std::string peer) : id(id), peer(std::move(peer)) {}
+};
+
+class IntrusiveListTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 5; ++i) {
+            pool.push_back(std::make_unique<Connection>(i, "peer" + std::to_string(i)));
+        }
+    }
+
+    static std::vector<int> ids(const IntrusiveList<Connection>& list) {
+        std::vector<int> out;
+        for (const auto& c : list) {
+            out.push_back(c.id);
+        }
+        return out;
+    }
+
+    std::vector<std::unique_ptr<Connection>> pool;
+};
+
+TEST_F(IntrusiveListTest, LinksWithoutCopying) {
+    IntrusiveList<Connection> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.front(), std::out_of_range);
+
+    for (auto& c : pool) {
+        list.push_back(*c);
+    }
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ(&list.front(), pool[0].get());
+    EXPECT_EQ(list.back().peer, "peer4");
+    EXPECT_EQ((--list.end())->id, 4);
+    EXPECT_EQ(list.rbegin()->id, 4);
+
+    auto it = list.erase(list.iterator_to(*pool[2]));
+    EXPECT_EQ(it->id, 3);
+    EXPECT_FALSE(pool[2]->IntrusiveListHook<>::is_linked());
+    list.insert(list.begin(), *pool[2]);
+    EXPECT_EQ(ids(list), (std::vector<int>{2, 0, 1, 3, 4}));
+
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(ids(list), (std::vector<int>{0, 1, 3}));
+}
+
+TEST_F(IntrusiveListTest, SelfUnlinkAndLruMove) {
+    IntrusiveList<Connection> lru;
+    for (auto& c : pool) {
+        lru.push_front(*c);
+    }
+    EXPECT_EQ(ids(lru), (std::vector<int>{4, 3, 2, 1, 0}));
+
+    lru.push_front(*pool[1]);
+    lru.push_front(*pool[1]);
+    EXPECT_EQ(ids(lru), (std::vector<int>{1, 4, 3, 2, 0}));
+
+    pool[3]->IntrusiveListHook<>::unlink();
+    pool[4].reset();
+    EXPECT_EQ(ids(lru), (std::vector<int>{1, 2, 0}));
+
+    Connection copy(*pool[2]);
+    EXPECT_FALSE(copy.IntrusiveListHook<>::is_linked());
+}
+
+TEST_F(IntrusiveListTest, SeveralListsAndMove) {
+    IntrusiveList<Connection> active;
+    IntrusiveList<Connection, ByAge> by_age;
+    for (auto& c : pool) {
+        active.push_back(*c);
+        by_age.push_front(*c);
+    }
+    active.erase(active.begin());
+    EXPECT_EQ(by_age.size(), 5);
+    EXPECT_EQ(by_age.back().id, 0);
+
+    IntrusiveList<Connection> moved(std::move(active));
+    EXPECT_TRUE(active.empty());
+    EXPECT_EQ(ids(moved), (std::vector<int>{1, 2, 3, 4}));
+
+    IntrusiveList<Connection> other;
+    other.push_back(*pool[0]);
+    other.swap(moved);
+    EXPECT_EQ(ids(other), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(ids(moved), (std::vector<int>{0}));
+
+    other.clear();
+    EXPECT_TRUE(other.empty());
+    EXPECT_FALSE(pool[1]->IntrusiveListHook<>::is_linked());
+    EXPECT_TRUE(pool[1]->IntrusiveListHook<ByAge>::is_linked());
+}
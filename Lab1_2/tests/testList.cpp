@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "List.h"
 #include <algorithm>
+#include <memory>
 #include <string>
 
 using namespace my_cont;
@@ -302,6 +303,243 @@ TEST_F(ListTest, LargeList) {
     EXPECT_TRUE(largeList.empty());
 }
 
+TEST_F(ListTest, UncheckedIteration) {
+    static_assert(!std::is_polymorphic_v<List<int>>);
+    static_assert(std::is_final_v<List<int>>);
+
+    int sum = 0;
+    for (int& value : listWithValues.unchecked()) {
+        value *= 2;
+    }
+    for (int value : std::as_const(listWithValues).unchecked()) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 30);
+    EXPECT_EQ(listWithValues.front(), 2);
+
+    auto range = emptyList.unchecked();
+    EXPECT_EQ(range.begin(), range.end());
+    EXPECT_THROW(*emptyList.begin(), std::out_of_range);
+}
+
+TEST(PolymorphicListTest, ThroughInterface) {
+    PolymorphicList<int> wrapped{1, 2};
+    SequenceContainer<int>& seq = wrapped;
+    seq.push_front(0);
+    seq.push_back(3);
+    EXPECT_EQ(seq.size(), 4);
+    EXPECT_EQ(seq.front(), 0);
+    EXPECT_EQ(seq.back(), 3);
+    seq.pop_back();
+    seq.pop_front();
+    EXPECT_EQ(wrapped.get(), (List<int>{1, 2}));
+    seq.clear();
+    EXPECT_TRUE(seq.empty());
+}
+
+TEST_F(ListTest, Splice) {
+    List<int> other{10, 20, 30};
+    int* ten = &other.front();
+
+    listWithValues.splice(++listWithValues.begin(), other, other.begin());
+    EXPECT_EQ(listWithValues, (List<int>{1, 10, 2, 3, 4, 5}));
+    EXPECT_EQ(&*(++listWithValues.begin()), ten);
+    EXPECT_EQ(other, (List<int>{20, 30}));
+
+    listWithValues.splice(listWithValues.end(), other);
+    EXPECT_EQ(listWithValues, (List<int>{1, 10, 2, 3, 4, 5, 20, 30}));
+    EXPECT_TRUE(other.empty());
+
+    auto first = listWithValues.begin().next(2);
+    auto last = listWithValues.begin().next(5);
+    other.splice(other.end(), listWithValues, first, last);
+    EXPECT_EQ(other, (List<int>{2, 3, 4}));
+    EXPECT_EQ(listWithValues.size(), 5);
+
+    listWithValues.splice(listWithValues.begin(), listWithValues, listWithValues.begin().next(3), listWithValues.end());
+    EXPECT_EQ(listWithValues, (List<int>{20, 30, 1, 10, 5}));
+    EXPECT_EQ(listWithValues.back(), 5);
+    listWithValues.splice(listWithValues.end(), listWithValues, listWithValues.begin());
+    EXPECT_EQ(listWithValues, (List<int>{30, 1, 10, 5, 20}));
+}
+
+TEST_F(ListTest, MergeAndSort) {
+    List<int> a{1, 4, 6, 9};
+    List<int> b{2, 3, 4, 10, 11};
+    a.merge(b);
+    EXPECT_EQ(a, (List<int>{1, 2, 3, 4, 4, 6, 9, 10, 11}));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.back(), 11);
+
+    List<int> shuffled{5, 3, 9, 1, 1, 8, 2, 7, 0, 6, 4};
+    shuffled.sort();
+    EXPECT_EQ(shuffled, (List<int>{0, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(*shuffled.rbegin(), 9);
+    shuffled.sort(std::greater<>());
+    EXPECT_EQ(shuffled.front(), 9);
+    EXPECT_EQ(shuffled.back(), 0);
+
+    List<std::pair<int, int>> pairs{{2, 0}, {1, 0}, {2, 1}, {1, 1}, {2, 2}};
+    pairs.sort([](const auto& x, const auto& y) { return x.first < y.first; });
+    EXPECT_EQ(pairs, (List<std::pair<int, int>>{{1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}}));
+
+    List<int> large;
+    for (int i = 0; i < 1000; ++i) {
+        large.push_front((i * 7919) % 1000);
+    }
+    large.sort();
+    int expected = 0;
+    for (int value : large) {
+        ASSERT_EQ(value, expected++);
+    }
+}
+
+TEST_F(ListTest, UniqueRemoveReverse) {
+    List<int> values{1, 1, 2, 2, 2, 3, 1, 1};
+    EXPECT_EQ(values.unique(), 4);
+    EXPECT_EQ(values, (List<int>{1, 2, 3, 1}));
+
+    EXPECT_EQ(values.remove(values.front()), 2);
+    EXPECT_EQ(values, (List<int>{2, 3}));
+
+    EXPECT_EQ(listWithValues.remove_if([](int x) { return x % 2 == 0; }), 2);
+    EXPECT_EQ(listWithValues, (List<int>{1, 3, 5}));
+
+    listWithValues.reverse();
+    EXPECT_EQ(listWithValues, (List<int>{5, 3, 1}));
+    EXPECT_EQ(*listWithValues.rbegin(), 1);
+    emptyList.reverse();
+    EXPECT_TRUE(emptyList.empty());
+}
+
+TEST_F(ListTest, EmplaceAndMoveOnly) {
+    List<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(2));
+    owners.emplace_front(new int(1));
+    auto it = owners.emplace(owners.end(), std::make_unique<int>(4));
+    owners.insert(it, std::make_unique<int>(3));
+    EXPECT_EQ(*owners.emplace_back(std::make_unique<int>(5)), 5);
+    ASSERT_EQ(owners.size(), 5);
+    int expected = 1;
+    for (const auto& p : owners) {
+        EXPECT_EQ(*p, expected++);
+    }
+
+    List<std::string> strings;
+    std::string long_text(100, 'x');
+    const char* buffer = long_text.data();
+    strings.push_back(std::move(long_text));
+    EXPECT_EQ(strings.front().data(), buffer);
+    EXPECT_EQ(strings.emplace_back(3, 'y'), "yyy");
+
+    strings.resize(4);
+    EXPECT_EQ(strings.back(), "");
+}
+
+TEST_F(ListTest, SpliceMoveOnly) {
+    List<std::unique_ptr<int>> a;
+    List<std::unique_ptr<int>> b;
+    for (int i = 0; i < 4; ++i) {
+        a.push_back(std::make_unique<int>(i));
+        b.push_back(std::make_unique<int>(10 + i));
+    }
+    int* ten = b.front().get();
+    a.splice(a.begin(), b, b.begin());
+    a.splice(a.end(), b, b.begin(), b.begin().next(2));
+    a.splice(a.end(), b);
+    EXPECT_TRUE(b.empty());
+    ASSERT_EQ(a.size(), 8);
+    EXPECT_EQ(a.front().get(), ten);
+    EXPECT_EQ(*a.back(), 13);
+}
+
+TEST(PooledListTest, ReusesErasedNodes) {
+    PooledList<int> list{1, 2, 3};
+    const NodePool& pool = list.get_allocator().resource();
+    EXPECT_EQ(pool.live_blocks(), 3);
+    EXPECT_EQ(pool.chunks_allocated(), 1);
+
+    const int* second = &*(++list.begin());
+    list.erase(++list.begin());
+    list.push_back(4);
+    EXPECT_EQ(&list.back(), second);
+    EXPECT_EQ(pool.live_blocks(), 3);
+}
+
+TEST(PooledListTest, ClearReleasesChunks) {
+    PooledList<std::string> list(PoolAllocator<std::string>(16));
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(std::to_string(i));
+    }
+    const NodePool& pool = list.get_allocator().resource();
+    EXPECT_EQ(pool.chunks_allocated(), 7);
+
+    list.pop_front();
+    list.clear();
+    EXPECT_EQ(pool.chunks_allocated(), 0);
+    EXPECT_EQ(pool.live_blocks(), 0);
+
+    list.push_back("again");
+    EXPECT_EQ(list.front(), "again");
+}
+
+TEST(PooledListTest, CopyMoveAndSwap) {
+    PooledList<int> a{1, 2, 3};
+    PooledList<int> copy(a);
+    EXPECT_EQ(copy, a);
+    EXPECT_NE(copy.get_allocator(), a.get_allocator());
+
+    PooledList<int> moved(std::move(a));
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_EQ(moved.get_allocator().resource().live_blocks(), 3);
+
+    copy = std::move(moved);
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_TRUE(moved.empty());
+
+    PooledList<int> other{9};
+    other.swap(copy);
+    EXPECT_EQ(other.size(), 3);
+    other.push_back(4);
+    EXPECT_EQ(other.back(), 4);
+}
+
+TEST(PooledListTest, MovedFromListsStayUsable) {
+    PooledList<int> a{1, 2, 3};
+    PooledList<int> b(std::move(a));
+    a.push_back(1);
+    a.push_front(0);
+    EXPECT_EQ(a, (PooledList<int>{0, 1}));
+    EXPECT_EQ(b.size(), 3);
+
+    PooledList<int> c{7, 8};
+    PooledList<int> d{5};
+    d = std::move(c);
+    c.push_back(9);
+    EXPECT_EQ(c.front(), 9);
+    EXPECT_EQ(d, (PooledList<int>{7, 8}));
+    c.clear();
+    EXPECT_EQ(d.back(), 8);
+}
+
+TEST(PooledListTest, SpliceMovesBetweenPools) {
+    PooledList<std::unique_ptr<int>> a;
+    PooledList<std::unique_ptr<int>> b;
+    for (int i = 0; i < 4; ++i) {
+        b.push_back(std::make_unique<int>(i));
+    }
+    int* zero = b.front().get();
+    a.splice(a.end(), b, b.begin());
+    a.splice(a.end(), b, b.begin(), b.begin().next(2));
+    a.splice(a.end(), b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.get_allocator().resource().live_blocks(), 0);
+    EXPECT_EQ(a.get_allocator().resource().live_blocks(), 4);
+    ASSERT_EQ(a.size(), 4);
+    EXPECT_EQ(a.front().get(), zero);
+    EXPECT_EQ(*a.back(), 3);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
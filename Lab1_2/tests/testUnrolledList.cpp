@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "unrolled_list.h"
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+using namespace my_cont;
+
+class UnrolledListTest : public ::testing::Test {
+protected:
+    UnrolledList<int, 4> emptyList;
+    UnrolledList<int, 4> listWithValues{1, 2, 3, 4, 5};
+};
+
+TEST_F(UnrolledListTest, Basics) {
+    EXPECT_TRUE(emptyList.empty());
+    EXPECT_THROW(emptyList.front(), std::out_of_range);
+    EXPECT_THROW(emptyList.pop_back(), std::out_of_range);
+    EXPECT_EQ(emptyList.begin(), emptyList.end());
+
+    EXPECT_EQ(listWithValues.size(), 5);
+    EXPECT_EQ(listWithValues.front(), 1);
+    EXPECT_EQ(listWithValues.back(), 5);
+    EXPECT_EQ(listWithValues.node_count(), 2);
+    EXPECT_EQ(*listWithValues.rbegin(), 5);
+    EXPECT_EQ(*--listWithValues.end(), 5);
+}
+
+TEST_F(UnrolledListTest, InsertAndEraseLikeList) {
+    auto it = listWithValues.insert(++listWithValues.begin(), 10);
+    EXPECT_EQ(*it, 10);
+    EXPECT_EQ(listWithValues, (UnrolledList<int, 4>{1, 10, 2, 3, 4, 5}));
+
+    it = listWithValues.erase(it);
+    EXPECT_EQ(*it, 2);
+    listWithValues.insert(listWithValues.end(), 6);
+    listWithValues.push_front(0);
+    EXPECT_EQ(listWithValues, (UnrolledList<int, 4>{0, 1, 2, 3, 4, 5, 6}));
+
+    listWithValues.pop_front();
+    listWithValues.pop_back();
+    EXPECT_EQ(listWithValues, (UnrolledList<int, 4>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(emptyList.erase(emptyList.begin()), emptyList.end());
+}
+
+TEST_F(UnrolledListTest, MatchesStdListUnderRandomEdits) {
+    UnrolledList<std::string, 8> list;
+    std::list<std::string> reference;
+    std::mt19937 gen(7);
+    for (int step = 0; step < 5000; ++step) {
+        size_t pos = reference.empty() ? 0 : gen() % (reference.size() + 1);
+        auto it = list.begin();
+        auto ref = reference.begin();
+        for (size_t i = 0; i < pos; ++i, ++it, ++ref) {}
+        if (gen() % 3 != 0 || reference.empty() || ref == reference.end()) {
+            std::string value = std::to_string(step);
+            EXPECT_EQ(*list.insert(it, value), value);
+            reference.insert(ref, value);
+        } else {
+            auto next = list.erase(it);
+            auto ref_next = reference.erase(ref);
+            if (ref_next != reference.end()) {
+                ASSERT_EQ(*next, *ref_next);
+            } else {
+                ASSERT_EQ(next, list.end());
+            }
+        }
+        ASSERT_EQ(list.size(), reference.size());
+    }
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    EXPECT_TRUE(std::equal(list.rbegin(), list.rend(), reference.rbegin(), reference.rend()));
+}
+
+TEST_F(UnrolledListTest, CopyMoveAndCompare) {
+    UnrolledList<int, 4> copy(listWithValues);
+    EXPECT_EQ(copy, listWithValues);
+    copy.back() = 50;
+    EXPECT_LT(listWithValues, copy);
+
+    UnrolledList<int, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.back(), 50);
+
+    moved.resize(2, 0);
+    EXPECT_EQ(moved, (UnrolledList<int, 4>{1, 2}));
+    moved.resize(4, 9);
+    EXPECT_EQ(moved, (UnrolledList<int, 4>{1, 2, 9, 9}));
+
+    moved.swap(emptyList);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(emptyList.size(), 4);
+}
+
+TEST_F(UnrolledListTest, DenserThanList) {
+    UnrolledList<int> list;
+    for (int i = 0; i < 10000; ++i) {
+        list.push_back(i);
+    }
+    EXPECT_LE(list.node_count(), 10000 / (UnrolledList<int>::node_capacity / 2) + 1);
+    int expected = 0;
+    for (int value : list) {
+        ASSERT_EQ(value, expected++);
+    }
+}
+
+struct ThrowsOnNegative {
+    int value;
+
+    explicit ThrowsOnNegative(int v) : value(v) {
+        if (v < 0) throw std::runtime_error("negative");
+    }
+};
+
+TEST_F(UnrolledListTest, ThrowingPushLeavesNoEmptyNode) {
+    UnrolledList<ThrowsOnNegative, 2> list;
+    EXPECT_THROW(list.emplace(list.cend(), -1), std::runtime_error);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.node_count(), 0);
+    EXPECT_EQ(list.begin(), list.end());
+
+    list.emplace(list.cend(), 1);
+    list.emplace(list.cend(), 2);
+    EXPECT_THROW(list.emplace(list.cend(), -1), std::runtime_error);
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.node_count(), 1);
+    EXPECT_EQ(list.back().value, 2);
+}
@@ -0,0 +1,144 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrent_queue.h"
+#include "deque.h"
+
+using namespace my_cont;
+
+// The baseline the lock-free queues replace: a Deque guarded by one mutex.
+template<typename T>
+class LockedDeque {
+private:
+    Deque<T> deque;
+    std::mutex mutex;
+
+public:
+    bool try_push(const T& value) {
+        std::lock_guard lock(mutex);
+        deque.push_back(value);
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        std::lock_guard lock(mutex);
+        if (deque.empty()) {
+            return false;
+        }
+        out = deque.front();
+        deque.pop_front();
+        return true;
+    }
+};
+
+template<typename F>
+static double measure_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Moves total items from producers to consumers, one item per call.
+template<typename Queue>
+static double run(Queue& q, int producers, int consumers, long long total) {
+    return measure_ms([&] {
+        std::atomic<long long> popped{0};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (long long i = p; i < total; i += producers) {
+                    while (!q.try_push(i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                long long value;
+                while (popped.load(std::memory_order_relaxed) < total) {
+                    if (q.try_pop(value)) {
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    });
+}
+
+// Same traffic, but both sides move batches of up to batch items.
+template<typename Queue>
+static double run_bulk(Queue& q, int producers, int consumers, long long total, std::size_t batch) {
+    return measure_ms([&] {
+        std::atomic<long long> popped{0};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                std::vector<long long> values;
+                for (long long i = p; i < total;) {
+                    values.clear();
+                    for (; i < total && values.size() < batch; i += producers) {
+                        values.push_back(i);
+                    }
+                    for (auto it = values.begin(); it != values.end();) {
+                        std::size_t pushed = q.try_push_bulk(it, values.end());
+                        if (pushed == 0) {
+                            std::this_thread::yield();
+                        }
+                        it += static_cast<std::ptrdiff_t>(pushed);
+                    }
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                std::vector<long long> values(batch);
+                while (popped.load(std::memory_order_relaxed) < total) {
+                    std::size_t got = q.try_pop_bulk(values.begin(), batch);
+                    if (got == 0) {
+                        std::this_thread::yield();
+                    }
+                    popped.fetch_add(static_cast<long long>(got), std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    });
+}
+
+static void report(const char* name, long long total, double ms) {
+    std::cout << name << ": " << ms << " ms, " << total / ms / 1000.0 << " M items/s\n";
+}
+
+int main(int argc, char** argv) {
+    long long total = argc > 1 ? std::stoll(argv[1]) : 5'000'000;
+    int threads = argc > 2 ? std::stoi(argv[2]) : 4;
+    std::cout << "items: " << total << ", MPMC threads per side: " << threads << '\n';
+
+    {
+        LockedDeque<long long> locked;
+        report("1P1C mutex Deque", total, run(locked, 1, 1, total));
+        SpscQueue<long long> spsc(4096);
+        report("1P1C SpscQueue", total, run(spsc, 1, 1, total));
+        report("1P1C SpscQueue bulk(64)", total, run_bulk(spsc, 1, 1, total, 64));
+    }
+    {
+        LockedDeque<long long> locked;
+        report("MPMC mutex Deque", total, run(locked, threads, threads, total));
+        MpmcQueue<long long> mpmc(4096);
+        report("MPMC MpmcQueue", total, run(mpmc, threads, threads, total));
+        report("MPMC MpmcQueue bulk(64)", total, run_bulk(mpmc, threads, threads, total, 64));
+    }
+    return 0;
+}
@@ -0,0 +1,352 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace my_cont {
+    // Indices written by different threads are kept on separate cache lines so producers and
+    // consumers do not invalidate each other's line on every operation.
+    inline constexpr std::size_t CACHE_LINE = 64;
+
+    namespace detail {
+        inline std::size_t queue_capacity(std::size_t capacity) {
+            if (capacity < 2) throw std::invalid_argument("Queue capacity must be at least 2");
+            return std::bit_ceil(capacity);
+        }
+    }
+
+    // Bounded lock-free queue for exactly one producer thread and one consumer thread.
+    // Each side keeps a private copy of the other side's index and re-reads the shared one
+    // only when the copy says the ring is full (or empty), so the common case touches no
+    // shared cache line besides its own index.
+    template<typename T>
+    class SpscQueue {
+    private:
+        alignas(CACHE_LINE) std::atomic<std::size_t> tail{0};
+        std::size_t headCache = 0;
+
+        alignas(CACHE_LINE) std::atomic<std::size_t> head{0};
+        std::size_t tailCache = 0;
+
+        alignas(CACHE_LINE) T *slots;
+        std::size_t mask;
+
+        T *slot(std::size_t index) const noexcept {
+            return slots + (index & mask);
+        }
+
+        // Producer side: number of free slots, refreshing the cached head only when needed.
+        std::size_t freeSlots(std::size_t t, std::size_t wanted) noexcept {
+            std::size_t room = mask + 1 - (t - headCache);
+            if (room < wanted) {
+                headCache = head.load(std::memory_order_acquire);
+                room = mask + 1 - (t - headCache);
+            }
+            return room;
+        }
+
+        // Consumer side: number of ready elements, refreshing the cached tail only when needed.
+        std::size_t readySlots(std::size_t h, std::size_t wanted) noexcept {
+            std::size_t ready = tailCache - h;
+            if (ready < wanted) {
+                tailCache = tail.load(std::memory_order_acquire);
+                ready = tailCache - h;
+            }
+            return ready;
+        }
+
+    public:
+        // Capacity is rounded up to a power of two.
+        explicit SpscQueue(std::size_t capacity = 1024)
+            : mask(detail::queue_capacity(capacity) - 1) {
+            slots = std::allocator<T>().allocate(mask + 1);
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        ~SpscQueue() {
+            std::size_t t = tail.load(std::memory_order_relaxed);
+            for (std::size_t h = head.load(std::memory_order_relaxed); h != t; ++h) {
+                std::destroy_at(slot(h));
+            }
+            std::allocator<T>().deallocate(slots, mask + 1);
+        }
+
+        // Producer only. Returns false and leaves the arguments untouched when full.
+        template<typename... Args>
+        bool try_emplace(Args&&... args) {
+            std::size_t t = tail.load(std::memory_order_relaxed);
+            if (freeSlots(t, 1) == 0) {
+                return false;
+            }
+            ::new (static_cast<void *>(slot(t))) T(std::forward<Args>(args)...);
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_push(const T& value) {
+            return try_emplace(value);
+        }
+
+        bool try_push(T&& value) {
+            return try_emplace(std::move(value));
+        }
+
+        // Producer only. Moves as many of [first, last) as fit and publishes them at once;
+        // returns how many were pushed.
+        template<typename ForwardIt>
+        std::size_t try_push_bulk(ForwardIt first, ForwardIt last) {
+            std::size_t t = tail.load(std::memory_order_relaxed);
+            std::size_t room = freeSlots(t, static_cast<std::size_t>(std::distance(first, last)));
+            std::size_t pushed = 0;
+            try {
+                for (; pushed < room && first != last; ++pushed, ++first) {
+                    ::new (static_cast<void *>(slot(t + pushed))) T(std::ranges::iter_move(first));
+                }
+            } catch (...) {
+                tail.store(t + pushed, std::memory_order_release);
+                throw;
+            }
+            tail.store(t + pushed, std::memory_order_release);
+            return pushed;
+        }
+
+        // Consumer only.
+        bool try_pop(T& out) {
+            std::size_t h = head.load(std::memory_order_relaxed);
+            if (readySlots(h, 1) == 0) {
+                return false;
+            }
+            T *item = slot(h);
+            out = std::move(*item);
+            std::destroy_at(item);
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only. Moves up to maxCount elements to out and frees their slots at once.
+        template<typename OutputIt>
+        std::size_t try_pop_bulk(OutputIt out, std::size_t maxCount) {
+            std::size_t h = head.load(std::memory_order_relaxed);
+            std::size_t n = std::min(readySlots(h, maxCount), maxCount);
+            std::size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    T *item = slot(h + i);
+                    *out = std::move(*item);
+                    ++out;
+                    std::destroy_at(item);
+                }
+            } catch (...) {
+                head.store(h + i, std::memory_order_release);
+                throw;
+            }
+            head.store(h + n, std::memory_order_release);
+            return n;
+        }
+
+        // Exact only when called from one of the two queue threads with the other idle.
+        [[nodiscard]] std::size_t size_approx() const noexcept {
+            return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return size_approx() == 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return mask + 1;
+        }
+    };
+
+    // Bounded lock-free queue for any number of producers and consumers (D. Vyukov's design).
+    // Every cell carries a sequence number telling whose turn it is: a producer may fill cell
+    // i when its sequence equals the enqueue position, a consumer may empty it when it equals
+    // position + 1. A single CAS on the shared position claims a cell, or a run of cells for
+    // the bulk operations.
+    //
+    // T must be nothrow-movable: once a cell is claimed it has to be published.
+    template<typename T>
+    class MpmcQueue {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcQueue needs a nothrow move constructor");
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* item() noexcept {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        alignas(CACHE_LINE) std::atomic<std::size_t> enqueuePos{0};
+        alignas(CACHE_LINE) std::atomic<std::size_t> dequeuePos{0};
+        alignas(CACHE_LINE) Cell *cells;
+        std::size_t mask;
+
+        static std::ptrdiff_t lag(std::size_t sequence, std::size_t expected) noexcept {
+            return static_cast<std::ptrdiff_t>(sequence - expected);
+        }
+
+        // Claims up to wanted consecutive cells from position, where a cell is ready when its
+        // sequence equals its position + offset. Returns the first claimed position and count.
+        std::pair<std::size_t, std::size_t> claim(std::atomic<std::size_t>& position, std::size_t offset,
+                                                  std::size_t wanted) noexcept {
+            std::size_t pos = position.load(std::memory_order_relaxed);
+            for (;;) {
+                std::size_t ready = 0;
+                bool stale = false;
+                while (ready < wanted) {
+                    Cell& cell = cells[(pos + ready) & mask];
+                    std::ptrdiff_t diff = lag(cell.sequence.load(std::memory_order_acquire), pos + ready + offset);
+                    if (diff == 0) {
+                        ++ready;
+                        continue;
+                    }
+                    // A cell ahead of us in sequence means another thread already took pos.
+                    stale = ready == 0 && diff > 0;
+                    break;
+                }
+                if (stale) {
+                    pos = position.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (ready == 0) {
+                    return {pos, 0};
+                }
+                if (position.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                    return {pos, ready};
+                }
+            }
+        }
+
+    public:
+        // Capacity is rounded up to a power of two.
+        explicit MpmcQueue(std::size_t capacity = 1024)
+            : mask(detail::queue_capacity(capacity) - 1) {
+            cells = std::allocator<Cell>().allocate(mask + 1);
+            for (std::size_t i = 0; i <= mask; ++i) {
+                ::new (static_cast<void *>(cells + i)) Cell;
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        ~MpmcQueue() {
+            std::size_t end = enqueuePos.load(std::memory_order_relaxed);
+            for (std::size_t pos = dequeuePos.load(std::memory_order_relaxed); pos != end; ++pos) {
+                std::destroy_at(cells[pos & mask].item());
+            }
+            std::destroy(cells, cells + mask + 1);
+            std::allocator<Cell>().deallocate(cells, mask + 1);
+        }
+
+        // The value is built before a cell is claimed, so a throwing constructor leaves the
+        // queue unchanged.
+        template<typename... Args>
+        bool try_emplace(Args&&... args) {
+            T value(std::forward<Args>(args)...);
+            return try_push(std::move(value));
+        }
+
+        bool try_push(const T& value) {
+            T copy(value);
+            return try_push(std::move(copy));
+        }
+
+        bool try_push(T&& value) noexcept {
+            auto [pos, n] = claim(enqueuePos, 0, 1);
+            if (n == 0) {
+                return false;
+            }
+            Cell& cell = cells[pos & mask];
+            ::new (static_cast<void *>(cell.storage)) T(std::move(value));
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Moves as many of [first, last) as fit into one contiguous run of cells; returns how
+        // many were pushed. Elements of the run become visible to consumers one by one.
+        template<typename ForwardIt>
+            requires std::is_nothrow_constructible_v<T, std::iter_rvalue_reference_t<ForwardIt>>
+        std::size_t try_push_bulk(ForwardIt first, ForwardIt last) {
+            auto [pos, n] = claim(enqueuePos, 0, static_cast<std::size_t>(std::distance(first, last)));
+            for (std::size_t i = 0; i < n; ++i, ++first) {
+                Cell& cell = cells[(pos + i) & mask];
+                ::new (static_cast<void *>(cell.storage)) T(std::ranges::iter_move(first));
+                cell.sequence.store(pos + i + 1, std::memory_order_release);
+            }
+            return n;
+        }
+
+        bool try_pop(T& out) {
+            auto [pos, n] = claim(dequeuePos, 1, 1);
+            if (n == 0) {
+                return false;
+            }
+            out = take(pos);
+            return true;
+        }
+
+        // If writing to out throws, the rest of the claimed run is released (and dropped)
+        // before the exception propagates, so producers never wait on those cells.
+        template<typename OutputIt>
+        std::size_t try_pop_bulk(OutputIt out, std::size_t maxCount) {
+            auto [pos, n] = claim(dequeuePos, 1, maxCount);
+            std::size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    *out = take(pos + i);
+                    ++out;
+                }
+            } catch (...) {
+                for (++i; i < n; ++i) {
+                    take(pos + i);
+                }
+                throw;
+            }
+            return n;
+        }
+
+        [[nodiscard]] std::size_t size_approx() const noexcept {
+            std::size_t tail = enqueuePos.load(std::memory_order_acquire);
+            std::size_t head = dequeuePos.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return size_approx() == 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return mask + 1;
+        }
+
+    private:
+        // Moves the element at a claimed position out and hands the cell to the next lap.
+        // Only nothrow steps happen before the cell is released; assigning the result to the
+        // caller's destination comes after.
+        T take(std::size_t pos) noexcept {
+            Cell& cell = cells[pos & mask];
+            T value(std::move(*cell.item()));
+            std::destroy_at(cell.item());
+            cell.sequence.store(pos + mask + 1, std::memory_order_release);
+            return value;
+        }
+    };
+}
+
+#endif // CONCURRENT_QUEUE_H
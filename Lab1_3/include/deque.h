@@ -1,194 +1,486 @@
 #ifndef DEQUE_H
 #define DEQUE_H
 
+#include <bit>
 #include "../../Lab1_2/include/list.h"
 
 namespace my_cont {
+    // Block-map deque: elements live in fixed-size blocks, and a central map holds the block
+    // pointers with free slots on both sides. Indexing is two loads, push/pop at either end
+    // is amortized O(1) and touches the map only when a block fills up or empties.
+    // Elements never move on push/pop, so references stay valid until the element is erased.
     template<class T>
-    class Deque : public List<T> {
+    class Deque : public Container<T> {
     private:
-        List<T> list;
+        // Roughly 512 bytes per block, rounded to a power of two so / and % become shifts.
+        static constexpr std::size_t BLOCK = std::bit_floor(std::max<std::size_t>(16, 512 / sizeof(T)));
+        static constexpr std::size_t MIN_MAP = 8;
 
-    public:
-        Deque() {
-            list = List<T>();
+        T **map = nullptr;
+        std::size_t mapSize = 0;
+        // Offset of the front element counted from the start of map[0].
+        std::size_t first = 0;
+        std::size_t count = 0;
+
+        static T *allocateBlock() {
+            return std::allocator<T>().allocate(BLOCK);
         }
 
-        Deque(std::initializer_list<T> init) {
-            list = List<T>(init);
+        static void freeBlock(T *block) noexcept {
+            std::allocator<T>().deallocate(block, BLOCK);
+        }
+
+        T *slot(std::size_t offset) const noexcept {
+            return map[offset / BLOCK] + offset % BLOCK;
+        }
+
+        T &element(std::size_t pos) const noexcept {
+            return *slot(first + pos);
+        }
+
+        [[nodiscard]] std::size_t usedBlocks() const noexcept {
+            return count == 0 ? 0 : (first + count - 1) / BLOCK - first / BLOCK + 1;
         }
 
-        Deque(const Deque &other) : List<T>(other.list) {
-            list = other.list;
+        // Re-centres the used blocks, growing the map when it is more than half full.
+        void remap() {
+            std::size_t firstBlock = first / BLOCK;
+            std::size_t used = usedBlocks();
+            std::size_t newSize = mapSize > 2 * (used + 1) ? mapSize : std::max(MIN_MAP, 2 * mapSize);
+            std::size_t start = (newSize - used) / 2;
+            if (newSize == mapSize) {
+                if (start < firstBlock) {
+                    std::copy(map + firstBlock, map + firstBlock + used, map + start);
+                } else {
+                    std::copy_backward(map + firstBlock, map + firstBlock + used, map + start + used);
+                }
+                std::fill(map, map + start, nullptr);
+                std::fill(map + start + used, map + mapSize, nullptr);
+            } else {
+                T **fresh = new T *[newSize]();
+                std::copy(map + firstBlock, map + firstBlock + used, fresh + start);
+                delete[] map;
+                map = fresh;
+                mapSize = newSize;
+            }
+            first = start * BLOCK + first % BLOCK;
         }
 
-        Deque(Deque &&other) noexcept {
-            list = other.list;
-            other.list.clear();
+        // Constructs an element at the given offset, allocating its block when needed.
+        template<typename... Args>
+        T &constructAt(std::size_t offset, Args&&... args) {
+            T *&block = map[offset / BLOCK];
+            bool fresh = block == nullptr;
+            if (fresh) {
+                block = allocateBlock();
+            }
+            try {
+                return *::new (static_cast<void *>(block + offset % BLOCK)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                if (fresh) {
+                    freeBlock(block);
+                    block = nullptr;
+                }
+                throw;
+            }
         }
 
+        // Destroys the element at offset and frees its block if it was the block's last one.
+        void destroyAt(std::size_t offset, bool lastInBlock) noexcept {
+            T *&block = map[offset / BLOCK];
+            std::destroy_at(block + offset % BLOCK);
+            if (lastInBlock) {
+                freeBlock(block);
+                block = nullptr;
+            }
+        }
+
+        void recenterIfEmpty() noexcept {
+            if (count == 0) {
+                first = mapSize / 2 * BLOCK;
+            }
+        }
+
+    public:
+        template <typename IterType>
+        class DequeIterator {
+        private:
+            friend class Deque;
+            using owner_type = std::conditional_t<std::is_const_v<IterType>, const Deque, Deque>;
+
+            owner_type *owner = nullptr;
+            std::size_t pos = 0;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<IterType>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
+
+            DequeIterator() = default;
+            DequeIterator(owner_type *owner, std::size_t pos) : owner(owner), pos(pos) {}
+
+            template<typename Other>
+                requires (std::is_const_v<IterType> && !std::is_const_v<Other>)
+            DequeIterator(const DequeIterator<Other>& other) : owner(other.owner), pos(other.pos) {}
+
+            IterType& operator*() const {
+                if (!owner || pos >= owner->count) throw std::out_of_range("Dereferencing null iterator");
+                return owner->element(pos);
+            }
+
+            IterType* operator->() const { return &owner->element(pos); }
+
+            IterType& operator[](difference_type n) const {
+                return owner->element(pos + n);
+            }
+
+            DequeIterator& operator++() {
+                ++pos;
+                return *this;
+            }
+
+            DequeIterator operator++(int) {
+                DequeIterator tmp = *this;
+                ++pos;
+                return tmp;
+            }
+
+            DequeIterator& operator--() {
+                --pos;
+                return *this;
+            }
+
+            DequeIterator operator--(int) {
+                DequeIterator tmp = *this;
+                --pos;
+                return tmp;
+            }
+
+            DequeIterator& operator+=(difference_type n) {
+                pos += n;
+                return *this;
+            }
+
+            DequeIterator& operator-=(difference_type n) {
+                pos -= n;
+                return *this;
+            }
+
+            DequeIterator operator+(difference_type n) const {
+                return DequeIterator(owner, pos + n);
+            }
+
+            friend DequeIterator operator+(difference_type n, const DequeIterator& it) {
+                return it + n;
+            }
+
+            DequeIterator operator-(difference_type n) const {
+                return DequeIterator(owner, pos - n);
+            }
+
+            difference_type operator-(const DequeIterator& other) const {
+                return static_cast<difference_type>(pos) - static_cast<difference_type>(other.pos);
+            }
+
+            bool operator==(const DequeIterator& other) const {
+                return pos == other.pos;
+            }
+
+            auto operator<=>(const DequeIterator& other) const {
+                return pos <=> other.pos;
+            }
+
+            template<typename U>
+            friend class DequeIterator;
+        };
+
+        using Iterator = DequeIterator<T>;
+        using ConstIterator = DequeIterator<const T>;
+        using ReverseIterator = std::reverse_iterator<Iterator>;
+        using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+        Deque() = default;
+
+        Deque(std::initializer_list<T> init) {
+            for (const auto& val : init) {
+                push_back(val);
+            }
+        }
+
+        Deque(const Deque &other) : Container<T>(other) {
+            for (const auto& val : other) {
+                push_back(val);
+            }
+        }
+
+        Deque(Deque &&other) noexcept
+            : map(std::exchange(other.map, nullptr)), mapSize(std::exchange(other.mapSize, 0)),
+              first(std::exchange(other.first, 0)), count(std::exchange(other.count, 0)) {}
+
         ~Deque() override {
-            list.clear();
+            clear();
+            delete[] map;
         }
 
         Deque &operator=(const Deque &other) {
             if (this != &other) {
-                list.clear();
-                list = other.list;
+                Deque copy(other);
+                swap(copy);
             }
             return *this;
         }
 
         Deque &operator=(Deque &&other) noexcept {
             if (this != &other) {
-                list.clear();
-                list = other.list;
-                other.list.clear();
+                clear();
+                swap(other);
             }
             return *this;
         }
 
         T &at(std::size_t pos) {
-            if (pos >= list.size()) {
+            if (pos >= count) {
+                throw std::out_of_range("Deque::at. Pos is unreal.");
+            }
+            return element(pos);
+        }
+
+        const T &at(std::size_t pos) const {
+            if (pos >= count) {
                 throw std::out_of_range("Deque::at. Pos is unreal.");
             }
-            auto it = list.begin().next(pos);
-            return *it;
+            return element(pos);
         }
 
         T &operator[](std::size_t pos) {
-            if (pos >= list.size()) {
+            if (pos >= count) {
                 throw std::out_of_range("Deque::[]. Pos is unreal.");
             }
-            auto it = list.begin();
-            while(pos > 0) {
-                ++it;
-                pos--;
+            return element(pos);
+        }
+
+        const T &operator[](std::size_t pos) const {
+            if (pos >= count) {
+                throw std::out_of_range("Deque::[]. Pos is unreal.");
             }
-            return *it;
+            return element(pos);
         }
 
-        T &front() override {
-            return list.front();
+        T &front() {
+            if (count == 0) throw std::out_of_range("Deque is empty");
+            return element(0);
         }
 
-        T &back() override {
-            return list.back();
+        const T &front() const {
+            if (count == 0) throw std::out_of_range("Deque is empty");
+            return element(0);
         }
 
-        using Iterator = List<T>::iterator;
-        using ConstIterator = List<T>::const_iterator;
-        using ReverseIterator = List<T>::reverse_iterator;
-        using ConstReverseIterator = List<T>::const_reverse_iterator;
+        T &back() {
+            if (count == 0) throw std::out_of_range("Deque is empty");
+            return element(count - 1);
+        }
 
-        Iterator begin() const override {
-            return list.begin();
+        const T &back() const {
+            if (count == 0) throw std::out_of_range("Deque is empty");
+            return element(count - 1);
         }
 
-        Iterator end() const override {
-            return list.end();
+        Iterator begin() { return Iterator(this, 0); }
+        ConstIterator begin() const { return ConstIterator(this, 0); }
+        ConstIterator cbegin() const { return begin(); }
+
+        Iterator end() { return Iterator(this, count); }
+        ConstIterator end() const { return ConstIterator(this, count); }
+        ConstIterator cend() const { return end(); }
+
+        ReverseIterator rbegin() { return ReverseIterator(end()); }
+        ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); }
+        ConstReverseIterator crbegin() const { return rbegin(); }
+
+        ReverseIterator rend() { return ReverseIterator(begin()); }
+        ConstReverseIterator rend() const { return ConstReverseIterator(begin()); }
+        ConstReverseIterator crend() const { return rend(); }
+
+        [[nodiscard]] bool empty() const override {
+            return count == 0;
         }
 
-        ConstIterator cbegin() const override {
-            return list.cbegin();
+        [[nodiscard]] std::size_t size() const override {
+            return count;
         }
 
-        ConstIterator cend() const override {
-            return list.cend();
+        [[nodiscard]] std::size_t max_size() const override {
+            return count;
         }
 
-        ReverseIterator rbegin() const override {
-            return list.rbegin();
+        // Number of elements per block.
+        static constexpr std::size_t block_size() noexcept {
+            return BLOCK;
         }
 
-        ReverseIterator rend() const override {
-            return list.rend();
+        void clear() {
+            while (count > 0) {
+                pop_back();
+            }
         }
 
-        ConstReverseIterator crbegin() const override {
-            return list.crbegin();
+        // Shifts whichever side of pos is shorter, so the cost is min(pos, size - pos).
+        template<typename... Args>
+        Iterator emplace(ConstIterator posIter, Args&&... args) {
+            std::size_t pos = posIter.pos;
+            if (pos == 0) {
+                emplace_front(std::forward<Args>(args)...);
+                return begin();
+            }
+            if (pos == count) {
+                emplace_back(std::forward<Args>(args)...);
+                return Iterator(this, pos);
+            }
+            // Build the value first: the arguments may refer to elements about to move.
+            T tmp(std::forward<Args>(args)...);
+            if (pos < count - pos) {
+                emplace_front(std::move(front()));
+                std::move(begin() + 2, begin() + pos + 1, begin() + 1);
+            } else {
+                emplace_back(std::move(back()));
+                std::move_backward(begin() + pos, end() - 2, end() - 1);
+            }
+            element(pos) = std::move(tmp);
+            return Iterator(this, pos);
         }
 
-        ConstReverseIterator crend() const override {
-            return list.crend();
+        Iterator insert(ConstIterator posIter, const T& val) {
+            return emplace(posIter, val);
         }
 
-        [[nodiscard]] bool empty() const override {
-            return list.empty();
+        Iterator insert(ConstIterator posIter, T&& val) {
+            return emplace(posIter, std::move(val));
         }
 
-        [[nodiscard]] std::size_t size() const override {
-            return list.size();
+        Iterator erase(ConstIterator posIter) {
+            std::size_t pos = posIter.pos;
+            if (pos >= count) {
+                return end();
+            }
+            if (pos < count - pos - 1) {
+                std::move_backward(begin(), begin() + pos, begin() + pos + 1);
+                pop_front();
+            } else {
+                std::move(begin() + pos + 1, end(), begin() + pos);
+                pop_back();
+            }
+            return Iterator(this, pos);
         }
 
-        [[nodiscard]] std::size_t max_size() const override {
-            return list.max_size();
+        void push_back(const T& val) {
+            emplace_back(val);
         }
 
-        void clear() override {
-            list.clear();
+        void push_back(T&& val) {
+            emplace_back(std::move(val));
         }
 
-        Iterator insert(Iterator posIter, const T& val) override {
-            return list.insert(posIter, val);
+        template<typename... Args>
+        T &emplace_back(Args&&... args) {
+            if (first + count == mapSize * BLOCK) {
+                remap();
+            }
+            T &ref = constructAt(first + count, std::forward<Args>(args)...);
+            ++count;
+            return ref;
         }
 
-        Iterator erase(Iterator posIter) override {
-            return list.erase(posIter);
+        void pop_back() {
+            if (count == 0) throw std::out_of_range("Deque is empty");
+            std::size_t offset = first + count - 1;
+            --count;
+            destroyAt(offset, count == 0 || offset % BLOCK == 0);
+            recenterIfEmpty();
         }
 
-        void push_back(const T& val) override {
-            list.push_back(val);
+        void push_front(const T& val) {
+            emplace_front(val);
         }
 
-        void pop_back() override {
-            list.pop_back();
+        void push_front(T&& val) {
+            emplace_front(std::move(val));
         }
 
-        void push_front(const T& val) override {
-            list.push_front(val);
+        template<typename... Args>
+        T &emplace_front(Args&&... args) {
+            if (first == 0) {
+                remap();
+            }
+            T &ref = constructAt(first - 1, std::forward<Args>(args)...);
+            --first;
+            ++count;
+            return ref;
         }
 
-        void pop_front() override {
-            list.pop_front();
+        void pop_front() {
+            if (count == 0) throw std::out_of_range("Deque is empty");
+            std::size_t offset = first++;
+            --count;
+            destroyAt(offset, count == 0 || first % BLOCK == 0);
+            recenterIfEmpty();
         }
 
-        void resize(std::size_t newSize, T val) override {
-            list.resize(newSize, val);
+        void resize(std::size_t newSize) {
+            while (count > newSize) {
+                pop_back();
+            }
+            while (count < newSize) {
+                emplace_back();
+            }
+        }
+
+        void resize(std::size_t newSize, const T& val) {
+            while (count > newSize) {
+                pop_back();
+            }
+            while (count < newSize) {
+                push_back(val);
+            }
         }
 
         void swap(Deque &other) noexcept {
-            list.swap(other.list);
+            std::swap(map, other.map);
+            std::swap(mapSize, other.mapSize);
+            std::swap(first, other.first);
+            std::swap(count, other.count);
         }
 
         bool operator==(const Deque &other) const {
-            return list == other.list;
+            return count == other.count && std::equal(begin(), end(), other.begin());
         }
 
         bool operator!=(const Deque &other) const {
-            return list != other.list;
+            return !(*this == other);
         }
 
         bool operator<(const Deque &other) const {
-            return list < other.list;
+            return (*this <=> other) < 0;
         }
 
         bool operator<=(const Deque &other) const {
-            return list <= other.list;
+            return (*this <=> other) <= 0;
         }
 
         bool operator>(const Deque &other) const {
-            return list > other.list;
+            return (*this <=> other) > 0;
         }
 
         bool operator>=(const Deque &other) const {
-            return list >= other.list;
+            return (*this <=> other) >= 0;
         }
 
         std::strong_ordering operator<=>(const Deque &other) const {
-            return list <=> other.list;
+            return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
         }
     };
 };
 
-#endif //DEQUE_H
\ No newline at end of file
+#endif //DEQUE_H
@@ -0,0 +1,491 @@
+#ifndef RING_DEQUE_H
+#define RING_DEQUE_H
+
+#include <bit>
+#include "../../Lab1_2/include/list.h"
+
+namespace my_cont {
+    // Deque in one contiguous circular buffer. The capacity is a power of two, so wrapping an
+    // index is a single mask. By default a full buffer doubles; with Fixed = true it never
+    // reallocates and pushing into a full deque throws std::length_error instead, which suits
+    // bounded queues with a known maximum size.
+    template<class T, bool Fixed = false>
+    class RingDeque : public Container<T> {
+    private:
+        static constexpr std::size_t MIN_CAPACITY = 16;
+
+        T *buffer = nullptr;
+        std::size_t cap = 0;
+        std::size_t head = 0;
+        std::size_t count = 0;
+
+        static std::size_t roundCapacity(std::size_t n) {
+            return n == 0 ? 0 : std::bit_ceil(std::max(n, MIN_CAPACITY));
+        }
+
+        T *slot(std::size_t pos) const noexcept {
+            return buffer + ((head + pos) & (cap - 1));
+        }
+
+        T &element(std::size_t pos) const noexcept {
+            return *slot(pos);
+        }
+
+        // Moves the elements into a fresh buffer of newCap slots, unwrapping them to index 0.
+        void reallocate(std::size_t newCap) {
+            T *fresh = std::allocator<T>().allocate(newCap);
+            std::size_t moved = 0;
+            try {
+                for (; moved < count; ++moved) {
+                    ::new (static_cast<void *>(fresh + moved)) T(std::move_if_noexcept(element(moved)));
+                }
+            } catch (...) {
+                std::destroy(fresh, fresh + moved);
+                std::allocator<T>().deallocate(fresh, newCap);
+                throw;
+            }
+            destroyAll();
+            release();
+            buffer = fresh;
+            cap = newCap;
+            head = 0;
+        }
+
+        void destroyAll() noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                std::destroy_at(slot(i));
+            }
+        }
+
+        void release() noexcept {
+            if (buffer) {
+                std::allocator<T>().deallocate(buffer, cap);
+            }
+            buffer = nullptr;
+            cap = 0;
+        }
+
+        void makeRoom() {
+            if (count < cap) {
+                return;
+            }
+            if constexpr (Fixed) {
+                throw std::length_error("RingDeque is full");
+            } else {
+                reallocate(cap == 0 ? MIN_CAPACITY : cap * 2);
+            }
+        }
+
+    public:
+        template <typename IterType>
+        class RingIterator {
+        private:
+            friend class RingDeque;
+            using owner_type = std::conditional_t<std::is_const_v<IterType>, const RingDeque, RingDeque>;
+
+            owner_type *owner = nullptr;
+            std::size_t pos = 0;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<IterType>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
+
+            RingIterator() = default;
+            RingIterator(owner_type *owner, std::size_t pos) : owner(owner), pos(pos) {}
+
+            template<typename Other>
+                requires (std::is_const_v<IterType> && !std::is_const_v<Other>)
+            RingIterator(const RingIterator<Other>& other) : owner(other.owner), pos(other.pos) {}
+
+            IterType& operator*() const {
+                if (!owner || pos >= owner->count) throw std::out_of_range("Dereferencing null iterator");
+                return owner->element(pos);
+            }
+
+            IterType* operator->() const { return &owner->element(pos); }
+
+            IterType& operator[](difference_type n) const {
+                return owner->element(pos + n);
+            }
+
+            RingIterator& operator++() {
+                ++pos;
+                return *this;
+            }
+
+            RingIterator operator++(int) {
+                RingIterator tmp = *this;
+                ++pos;
+                return tmp;
+            }
+
+            RingIterator& operator--() {
+                --pos;
+                return *this;
+            }
+
+            RingIterator operator--(int) {
+                RingIterator tmp = *this;
+                --pos;
+                return tmp;
+            }
+
+            RingIterator& operator+=(difference_type n) {
+                pos += n;
+                return *this;
+            }
+
+            RingIterator& operator-=(difference_type n) {
+                pos -= n;
+                return *this;
+            }
+
+            RingIterator operator+(difference_type n) const {
+                return RingIterator(owner, pos + n);
+            }
+
+            friend RingIterator operator+(difference_type n, const RingIterator& it) {
+                return it + n;
+            }
+
+            RingIterator operator-(difference_type n) const {
+                return RingIterator(owner, pos - n);
+            }
+
+            difference_type operator-(const RingIterator& other) const {
+                return static_cast<difference_type>(pos) - static_cast<difference_type>(other.pos);
+            }
+
+            bool operator==(const RingIterator& other) const {
+                return pos == other.pos;
+            }
+
+            auto operator<=>(const RingIterator& other) const {
+                return pos <=> other.pos;
+            }
+
+            template<typename U>
+            friend class RingIterator;
+        };
+
+        using Iterator = RingIterator<T>;
+        using ConstIterator = RingIterator<const T>;
+        using ReverseIterator = std::reverse_iterator<Iterator>;
+        using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+        RingDeque() = default;
+
+        // Capacity is rounded up to a power of two (at least 16).
+        explicit RingDeque(std::size_t capacity) {
+            reserve(capacity);
+        }
+
+        RingDeque(std::initializer_list<T> init) {
+            reserve(init.size());
+            for (const auto& val : init) {
+                push_back(val);
+            }
+        }
+
+        RingDeque(const RingDeque &other) : Container<T>(other) {
+            reserve(Fixed ? other.cap : other.count);
+            for (const auto& val : other) {
+                push_back(val);
+            }
+        }
+
+        RingDeque(RingDeque &&other) noexcept
+            : buffer(std::exchange(other.buffer, nullptr)), cap(std::exchange(other.cap, 0)),
+              head(std::exchange(other.head, 0)), count(std::exchange(other.count, 0)) {}
+
+        ~RingDeque() override {
+            destroyAll();
+            release();
+        }
+
+        RingDeque &operator=(const RingDeque &other) {
+            if (this != &other) {
+                RingDeque copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        RingDeque &operator=(RingDeque &&other) noexcept {
+            if (this != &other) {
+                clear();
+                release();
+                swap(other);
+            }
+            return *this;
+        }
+
+        T &at(std::size_t pos) {
+            if (pos >= count) {
+                throw std::out_of_range("RingDeque::at. Pos is unreal.");
+            }
+            return element(pos);
+        }
+
+        const T &at(std::size_t pos) const {
+            if (pos >= count) {
+                throw std::out_of_range("RingDeque::at. Pos is unreal.");
+            }
+            return element(pos);
+        }
+
+        T &operator[](std::size_t pos) {
+            if (pos >= count) {
+                throw std::out_of_range("RingDeque::[]. Pos is unreal.");
+            }
+            return element(pos);
+        }
+
+        const T &operator[](std::size_t pos) const {
+            if (pos >= count) {
+                throw std::out_of_range("RingDeque::[]. Pos is unreal.");
+            }
+            return element(pos);
+        }
+
+        T &front() {
+            if (count == 0) throw std::out_of_range("RingDeque is empty");
+            return element(0);
+        }
+
+        const T &front() const {
+            if (count == 0) throw std::out_of_range("RingDeque is empty");
+            return element(0);
+        }
+
+        T &back() {
+            if (count == 0) throw std::out_of_range("RingDeque is empty");
+            return element(count - 1);
+        }
+
+        const T &back() const {
+            if (count == 0) throw std::out_of_range("RingDeque is empty");
+            return element(count - 1);
+        }
+
+        Iterator begin() { return Iterator(this, 0); }
+        ConstIterator begin() const { return ConstIterator(this, 0); }
+        ConstIterator cbegin() const { return begin(); }
+
+        Iterator end() { return Iterator(this, count); }
+        ConstIterator end() const { return ConstIterator(this, count); }
+        ConstIterator cend() const { return end(); }
+
+        ReverseIterator rbegin() { return ReverseIterator(end()); }
+        ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); }
+        ConstReverseIterator crbegin() const { return rbegin(); }
+
+        ReverseIterator rend() { return ReverseIterator(begin()); }
+        ConstReverseIterator rend() const { return ConstReverseIterator(begin()); }
+        ConstReverseIterator crend() const { return rend(); }
+
+        [[nodiscard]] bool empty() const override {
+            return count == 0;
+        }
+
+        [[nodiscard]] bool full() const noexcept {
+            return count == cap;
+        }
+
+        [[nodiscard]] std::size_t size() const override {
+            return count;
+        }
+
+        [[nodiscard]] std::size_t max_size() const override {
+            return count;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return cap;
+        }
+
+        // Grows the buffer to hold at least n elements; never shrinks.
+        // For a fixed deque this is how the bound is chosen.
+        void reserve(std::size_t n) {
+            std::size_t newCap = roundCapacity(n);
+            if (newCap > cap) {
+                reallocate(newCap);
+            }
+        }
+
+        // Keeps the buffer so a bounded queue does not reallocate after clear().
+        void clear() noexcept {
+            destroyAll();
+            head = 0;
+            count = 0;
+        }
+
+        template<typename... Args>
+        T &emplace_back(Args&&... args) {
+            if (count == cap) {
+                // Build the value first: the arguments may refer to elements about to move.
+                T tmp(std::forward<Args>(args)...);
+                makeRoom();
+                return emplace_back(std::move(tmp));
+            }
+            T *place = slot(count);
+            ::new (static_cast<void *>(place)) T(std::forward<Args>(args)...);
+            ++count;
+            return *place;
+        }
+
+        template<typename... Args>
+        T &emplace_front(Args&&... args) {
+            if (count == cap) {
+                T tmp(std::forward<Args>(args)...);
+                makeRoom();
+                return emplace_front(std::move(tmp));
+            }
+            std::size_t newHead = (head - 1) & (cap - 1);
+            T *place = buffer + newHead;
+            ::new (static_cast<void *>(place)) T(std::forward<Args>(args)...);
+            head = newHead;
+            ++count;
+            return *place;
+        }
+
+        void push_back(const T& val) {
+            emplace_back(val);
+        }
+
+        void push_back(T&& val) {
+            emplace_back(std::move(val));
+        }
+
+        void push_front(const T& val) {
+            emplace_front(val);
+        }
+
+        void push_front(T&& val) {
+            emplace_front(std::move(val));
+        }
+
+        void pop_back() {
+            if (count == 0) throw std::out_of_range("RingDeque is empty");
+            --count;
+            std::destroy_at(slot(count));
+        }
+
+        void pop_front() {
+            if (count == 0) throw std::out_of_range("RingDeque is empty");
+            std::destroy_at(slot(0));
+            head = (head + 1) & (cap - 1);
+            --count;
+        }
+
+        // Shifts whichever side of pos is shorter, so the cost is min(pos, size - pos).
+        template<typename... Args>
+        Iterator emplace(ConstIterator posIter, Args&&... args) {
+            std::size_t pos = posIter.pos;
+            if (pos == 0) {
+                emplace_front(std::forward<Args>(args)...);
+                return begin();
+            }
+            if (pos == count) {
+                emplace_back(std::forward<Args>(args)...);
+                return Iterator(this, pos);
+            }
+            T tmp(std::forward<Args>(args)...);
+            makeRoom();
+            if (pos < count - pos) {
+                emplace_front(std::move(front()));
+                std::move(begin() + 2, begin() + pos + 1, begin() + 1);
+            } else {
+                emplace_back(std::move(back()));
+                std::move_backward(begin() + pos, end() - 2, end() - 1);
+            }
+            element(pos) = std::move(tmp);
+            return Iterator(this, pos);
+        }
+
+        Iterator insert(ConstIterator posIter, const T& val) {
+            return emplace(posIter, val);
+        }
+
+        Iterator insert(ConstIterator posIter, T&& val) {
+            return emplace(posIter, std::move(val));
+        }
+
+        Iterator erase(ConstIterator posIter) {
+            std::size_t pos = posIter.pos;
+            if (pos >= count) {
+                return end();
+            }
+            if (pos < count - pos - 1) {
+                std::move_backward(begin(), begin() + pos, begin() + pos + 1);
+                pop_front();
+            } else {
+                std::move(begin() + pos + 1, end(), begin() + pos);
+                pop_back();
+            }
+            return Iterator(this, pos);
+        }
+
+        void resize(std::size_t newSize) {
+            while (count > newSize) {
+                pop_back();
+            }
+            while (count < newSize) {
+                emplace_back();
+            }
+        }
+
+        void resize(std::size_t newSize, const T& val) {
+            while (count > newSize) {
+                pop_back();
+            }
+            while (count < newSize) {
+                push_back(val);
+            }
+        }
+
+        void swap(RingDeque &other) noexcept {
+            std::swap(buffer, other.buffer);
+            std::swap(cap, other.cap);
+            std::swap(head, other.head);
+            std::swap(count, other.count);
+        }
+
+        bool operator==(const RingDeque &other) const {
+            return count == other.count && std::equal(begin(), end(), other.begin());
+        }
+
+        bool operator!=(const RingDeque &other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const RingDeque &other) const {
+            return (*this <=> other) < 0;
+        }
+
+        bool operator<=(const RingDeque &other) const {
+            return (*this <=> other) <= 0;
+        }
+
+        bool operator>(const RingDeque &other) const {
+            return (*this <=> other) > 0;
+        }
+
+        bool operator>=(const RingDeque &other) const {
+            return (*this <=> other) >= 0;
+        }
+
+        std::strong_ordering operator<=>(const RingDeque &other) const {
+            return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+        }
+    };
+
+    // Ring deque that never reallocates; the bound is fixed at construction.
+    template<class T>
+    using BoundedDeque = RingDeque<T, true>;
+};
+
+#endif //RING_DEQUE_H
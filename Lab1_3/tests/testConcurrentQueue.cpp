@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "concurrent_queue.h"
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace my_cont;
+
+TEST(SpscQueueTest, FifoAndFull) {
+    SpscQueue<int> q(5);
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_TRUE(q.empty());
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(8));
+    EXPECT_EQ(q.size_approx(), 8);
+
+    int value = -1;
+    for (int round = 0; round < 100; ++round) {
+        ASSERT_TRUE(q.try_pop(value));
+        ASSERT_EQ(value, round);
+        ASSERT_TRUE(q.try_push(round + 8));
+    }
+    EXPECT_THROW(SpscQueue<int>(1), std::invalid_argument);
+}
+
+TEST(SpscQueueTest, BulkPushAndPop) {
+    SpscQueue<std::unique_ptr<int>> q(16);
+    std::vector<std::unique_ptr<int>> in;
+    for (int i = 0; i < 20; ++i) {
+        in.push_back(std::make_unique<int>(i));
+    }
+    EXPECT_EQ(q.try_push_bulk(in.begin(), in.end()), 16);
+    EXPECT_EQ(in[15], nullptr);
+    EXPECT_NE(in[16], nullptr);
+
+    std::vector<std::unique_ptr<int>> out;
+    EXPECT_EQ(q.try_pop_bulk(std::back_inserter(out), 10), 10);
+    EXPECT_EQ(q.try_push_bulk(in.begin() + 16, in.end()), 4);
+    EXPECT_EQ(q.try_pop_bulk(std::back_inserter(out), 100), 10);
+    ASSERT_EQ(out.size(), 20);
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_EQ(*out[i], i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueueTest, TwoThreadsKeepOrder) {
+    const int n = 200000;
+    SpscQueue<int> q(64);
+    std::thread producer([&] {
+        for (int i = 0; i < n; ++i) {
+            while (!q.try_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    int batch[16];
+    while (expected < n) {
+        std::size_t got = q.try_pop_bulk(batch, 16);
+        for (std::size_t i = 0; i < got; ++i) {
+            ASSERT_EQ(batch[i], expected++);
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, FifoAndFull) {
+    MpmcQueue<std::string> q(4);
+    EXPECT_TRUE(q.try_push("a"));
+    EXPECT_TRUE(q.try_emplace(3, 'b'));
+    std::vector<std::string> more{"c", "d", "e"};
+    EXPECT_EQ(q.try_push_bulk(more.begin(), more.end()), 2);
+    EXPECT_FALSE(q.try_push("f"));
+    EXPECT_EQ(q.size_approx(), 4);
+
+    std::string value;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, "a");
+    std::vector<std::string> out;
+    EXPECT_EQ(q.try_pop_bulk(std::back_inserter(out), 10), 3);
+    EXPECT_EQ(out, (std::vector<std::string>{"bbb", "c", "d"}));
+    EXPECT_FALSE(q.try_pop(value));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, ManyProducersAndConsumers) {
+    const int producers = 4;
+    const int consumers = 4;
+    const long long perProducer = 20000;
+    MpmcQueue<long long> q(256);
+    std::atomic<long long> sum{0};
+    std::atomic<long long> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            long long values[8];
+            for (long long i = 0; i < perProducer; i += 8) {
+                std::iota(values, values + 8, p * perProducer + i + 1);
+                std::size_t done = 0;
+                while (done < 8) {
+                    std::size_t pushed = q.try_push_bulk(values + done, values + 8);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    done += pushed;
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            long long values[8];
+            while (popped.load() < producers * perProducer) {
+                std::size_t got = q.try_pop_bulk(values, 8);
+                if (got == 0) {
+                    std::this_thread::yield();
+                }
+                for (std::size_t i = 0; i < got; ++i) {
+                    sum += values[i];
+                }
+                popped += static_cast<long long>(got);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    long long total = producers * perProducer;
+    EXPECT_EQ(popped.load(), total);
+    EXPECT_EQ(sum.load(), total * (total + 1) / 2);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, DestroysLeftovers) {
+    auto tracker = std::make_shared<int>(0);
+    std::shared_ptr<int> out;
+    {
+        MpmcQueue<std::shared_ptr<int>> q(8);
+        for (int i = 0; i < 5; ++i) {
+            q.try_push(tracker);
+        }
+        q.try_pop(out);
+        EXPECT_EQ(tracker.use_count(), 6);
+    }
+    EXPECT_EQ(tracker.use_count(), 2);
+}
+
+// Output iterator whose assignment throws once `limit` values have been written.
+struct FailingSink {
+    std::vector<int>* values;
+    std::size_t limit;
+
+    FailingSink& operator*() { return *this; }
+    FailingSink& operator++() { return *this; }
+
+    FailingSink& operator=(int value) {
+        if (values->size() == limit) throw std::runtime_error("sink is full");
+        values->push_back(value);
+        return *this;
+    }
+};
+
+TEST(MpmcQueueTest, ThrowingSinkReleasesClaimedCells) {
+    MpmcQueue<int> q(4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.try_push(i));
+    }
+    std::vector<int> got;
+    EXPECT_THROW(q.try_pop_bulk(FailingSink{&got, 1}, 4), std::runtime_error);
+    EXPECT_EQ(got, std::vector<int>{0});
+    EXPECT_TRUE(q.empty());
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(q.try_push(10 * round + i));
+        }
+        EXPECT_FALSE(q.try_push(-1));
+        int value;
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(q.try_pop(value));
+            EXPECT_EQ(value, 10 * round + i);
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "deque.h"
 #include <algorithm>
+#include <memory>
 #include <string>
 
 using namespace my_cont;
@@ -254,6 +255,135 @@ TEST_F(DequeTest, InsertAtEdges) {
     EXPECT_EQ(d.back(), 20);
 }
 
+TEST_F(DequeTest, EmplaceAndMoveOnly) {
+    Deque<std::unique_ptr<std::string>> owners;
+    owners.emplace_back(new std::string("b"));
+    owners.push_front(std::make_unique<std::string>("a"));
+    owners.emplace(owners.end(), std::make_unique<std::string>("c"));
+    owners.insert(owners.begin(), std::make_unique<std::string>("_"));
+    EXPECT_EQ(*owners.emplace_front(new std::string("^")), "^");
+    ASSERT_EQ(owners.size(), 5);
+    EXPECT_EQ(*owners[1], "_");
+    EXPECT_EQ(*owners.back(), "c");
+
+    Deque<std::unique_ptr<std::string>> moved(std::move(owners));
+    EXPECT_TRUE(owners.empty());
+    EXPECT_EQ(*moved.front(), "^");
+    moved.resize(6);
+    EXPECT_EQ(moved.back(), nullptr);
+}
+
+TEST_F(DequeTest, IndexedAccessAfterMutations) {
+    Deque<int> d;
+    for (int i = 0; i < 20000; ++i) {
+        d.push_back(i);
+    }
+    long long sum = 0;
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        sum += d[i];
+    }
+    EXPECT_EQ(sum, 20000LL * 19999 / 2);
+    for (std::size_t i = d.size(); i-- > 0;) {
+        ASSERT_EQ(d.at(i), static_cast<int>(i));
+    }
+
+    EXPECT_EQ(d[10], 10);
+    d.push_front(-1);
+    EXPECT_EQ(d[11], 10);
+    d.pop_front();
+    d.pop_front();
+    EXPECT_EQ(d[9], 10);
+    d.insert(d.begin(), 100);
+    EXPECT_EQ(d[10], 10);
+    d.erase(d.begin());
+    EXPECT_EQ(d[9], 10);
+    EXPECT_EQ(d[d.size() - 1], 19999);
+    d.pop_back();
+    EXPECT_EQ(d[d.size() - 1], 19998);
+    d.resize(5);
+    EXPECT_EQ(d[4], 5);
+    EXPECT_THROW(d.at(5), std::out_of_range);
+}
+
+TEST_F(DequeTest, GrowsAcrossBlocksAtBothEnds) {
+    const int n = static_cast<int>(Deque<int>::block_size()) * 5 + 3;
+    Deque<int> d;
+    for (int i = 0; i < n; ++i) {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    ASSERT_EQ(d.size(), static_cast<std::size_t>(2 * n));
+    for (int i = 0; i < 2 * n; ++i) {
+        ASSERT_EQ(d[i], i - n);
+    }
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+    EXPECT_EQ(d.end() - d.begin(), 2 * n);
+    EXPECT_EQ(*(d.rbegin() + 1), n - 2);
+
+    while (d.size() > 1) {
+        d.pop_front();
+        d.pop_back();
+        if (!d.empty()) {
+            ASSERT_EQ(d.front(), -d.back() - 1);
+        }
+    }
+    EXPECT_TRUE(d.empty());
+}
+
+TEST_F(DequeTest, ReferencesSurvivePushes) {
+    Deque<std::string> d{"anchor"};
+    std::string &anchor = d.front();
+    for (int i = 0; i < 1000; ++i) {
+        d.push_back(std::to_string(i));
+        d.push_front(std::to_string(-i));
+    }
+    EXPECT_EQ(anchor, "anchor");
+    EXPECT_EQ(&d[1000], &anchor);
+}
+
+TEST_F(DequeTest, QueueUsageStaysCompact) {
+    Deque<int> d;
+    for (int i = 0; i < 100000; ++i) {
+        d.push_back(i);
+        if (d.size() > 10) {
+            ASSERT_EQ(d.front(), i - 10);
+            d.pop_front();
+        }
+    }
+    EXPECT_EQ(d.size(), 10);
+    EXPECT_EQ(d.back(), 99999);
+}
+
+TEST_F(DequeTest, InsertEraseInTheMiddle) {
+    Deque<int> d;
+    for (int i = 0; i < 100; ++i) {
+        d.push_back(i);
+    }
+    auto it = d.insert(d.begin() + 10, -1);
+    EXPECT_EQ(it - d.begin(), 10);
+    it = d.insert(d.begin() + 90, -2);
+    EXPECT_EQ(*it, -2);
+    EXPECT_EQ(d[9], 9);
+    EXPECT_EQ(d[10], -1);
+    EXPECT_EQ(d[11], 10);
+    EXPECT_EQ(d[90], -2);
+    EXPECT_EQ(d[91], 89);
+    EXPECT_EQ(d.size(), 102);
+
+    it = d.erase(d.begin() + 10);
+    EXPECT_EQ(*it, 10);
+    it = d.erase(d.begin() + 89);
+    EXPECT_EQ(*it, 89);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(d[i], i);
+    }
+    d.insert(d.begin() + 1, d[0]);
+    d.insert(d.end() - 1, d.back());
+    EXPECT_EQ(d[1], 0);
+    EXPECT_EQ(d[d.size() - 2], 99);
+    EXPECT_EQ(d.erase(d.end()), d.end());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "ring_deque.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+
+using namespace my_cont;
+
+TEST(RingDequeTest, PushPopBothEnds) {
+    RingDeque<int> d;
+    EXPECT_TRUE(d.empty());
+    EXPECT_EQ(d.capacity(), 0);
+
+    d.push_back(2);
+    d.push_front(1);
+    d.push_back(3);
+    ASSERT_EQ(d.size(), 3);
+    EXPECT_EQ(d.front(), 1);
+    EXPECT_EQ(d.back(), 3);
+    EXPECT_EQ(d[1], 2);
+    EXPECT_EQ(d.capacity(), 16);
+
+    d.pop_front();
+    d.pop_back();
+    EXPECT_EQ(d.front(), 2);
+    EXPECT_EQ(d.back(), 2);
+    d.pop_back();
+    EXPECT_THROW(d.pop_front(), std::out_of_range);
+    EXPECT_THROW(d.front(), std::out_of_range);
+}
+
+TEST(RingDequeTest, WrapsAroundAndGrows) {
+    RingDeque<int> d(16);
+    for (int i = 0; i < 10; ++i) {
+        d.push_back(i);
+    }
+    for (int i = 0; i < 8; ++i) {
+        d.pop_front();
+    }
+    for (int i = 10; i < 20; ++i) {
+        d.push_back(i);
+    }
+    EXPECT_EQ(d.capacity(), 16);
+    for (int i = 0; i < 12; ++i) {
+        ASSERT_EQ(d[i], i + 8);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        d.push_front(-i);
+    }
+    EXPECT_EQ(d.capacity(), 1024);
+    EXPECT_EQ(d.front(), -999);
+    EXPECT_EQ(d.back(), 19);
+    EXPECT_EQ(d.at(999), 0);
+    EXPECT_EQ(d.at(1000), 8);
+    EXPECT_THROW(d.at(d.size()), std::out_of_range);
+}
+
+TEST(RingDequeTest, CapacityIsPowerOfTwo) {
+    EXPECT_EQ(RingDeque<int>(100).capacity(), 128);
+    EXPECT_EQ(RingDeque<int>(3).capacity(), 16);
+    RingDeque<int> d{1, 2, 3};
+    d.reserve(600);
+    EXPECT_EQ(d.capacity(), 1024);
+    EXPECT_EQ(d, (RingDeque<int>{1, 2, 3}));
+}
+
+TEST(RingDequeTest, FixedCapacityNeverGrows) {
+    BoundedDeque<std::string> q(16);
+    for (int i = 0; i < 16; ++i) {
+        q.push_back(std::to_string(i));
+    }
+    EXPECT_TRUE(q.full());
+    EXPECT_THROW(q.push_back("x"), std::length_error);
+    EXPECT_THROW(q.emplace_front("x"), std::length_error);
+    EXPECT_THROW(q.insert(q.begin() + 5, "x"), std::length_error);
+    EXPECT_EQ(q.size(), 16);
+    EXPECT_EQ(q.front(), "0");
+    EXPECT_EQ(q[5], "5");
+
+    for (int i = 16; i < 1000; ++i) {
+        q.pop_front();
+        q.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(q.capacity(), 16);
+    EXPECT_EQ(q.front(), "984");
+    EXPECT_EQ(q.back(), "999");
+
+    BoundedDeque<std::string> copy(q);
+    EXPECT_EQ(copy.capacity(), 16);
+    EXPECT_EQ(copy, q);
+}
+
+TEST(RingDequeTest, InsertEraseAcrossTheSeam) {
+    RingDeque<int> d(16);
+    for (int i = 0; i < 12; ++i) {
+        d.push_back(i);
+    }
+    for (int i = 0; i < 8; ++i) {
+        d.pop_front();
+        d.push_back(12 + i);
+    }
+    auto it = d.insert(d.begin() + 3, -1);
+    EXPECT_EQ(it - d.begin(), 3);
+    d.insert(d.end() - 2, -2);
+    d.insert(d.begin(), d.back());
+    EXPECT_EQ(d.front(), 19);
+    EXPECT_EQ(d[4], -1);
+    EXPECT_EQ(d[d.size() - 3], -2);
+
+    d.erase(d.begin());
+    d.erase(d.begin() + 3);
+    d.erase(d.end() - 3);
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+    EXPECT_EQ(d.size(), 12);
+    EXPECT_EQ(d.front(), 8);
+    EXPECT_EQ(*d.rbegin(), 19);
+}
+
+TEST(RingDequeTest, MoveOnlyAndResize) {
+    RingDeque<std::unique_ptr<int>> d;
+    for (int i = 0; i < 40; ++i) {
+        d.emplace_back(new int(i));
+    }
+    d.emplace_front(new int(-1));
+    EXPECT_EQ(*d.front(), -1);
+    EXPECT_EQ(*d[40], 39);
+
+    RingDeque<std::unique_ptr<int>> moved(std::move(d));
+    EXPECT_TRUE(d.empty());
+    moved.resize(45);
+    EXPECT_EQ(moved.back(), nullptr);
+    moved.resize(2);
+    EXPECT_EQ(*moved.back(), 0);
+
+    RingDeque<std::unique_ptr<int>> other;
+    other.swap(moved);
+    EXPECT_EQ(other.size(), 2);
+    EXPECT_TRUE(moved.empty());
+}
+
+TEST(RingDequeTest, Comparisons) {
+    RingDeque<int> a{1, 2, 3};
+    RingDeque<int> b{1, 2, 4};
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(a != b);
+    EXPECT_EQ((a <=> a), std::strong_ordering::equal);
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.capacity(), 16);
+}
@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include "parallel_algorithms.h"
+
+using namespace my_cont;
+
+template<typename F>
+static double measure_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, double serial, double parallel) {
+    std::cout << name << ": serial " << serial << " ms, parallel " << parallel << " ms, speedup "
+              << serial / parallel << "x\n";
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoul(argv[1]) : 20'000'000;
+    std::mt19937_64 gen(1);
+    Vector<long long> data;
+    data.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        data.push_back(static_cast<long long>(gen() % 1'000'000));
+    }
+    std::cout << "elements: " << n << ", threads: " << ThreadPool::shared().size() << '\n';
+
+    Vector<long long> a(data), b(data);
+    report("sort", measure_ms([&] { std::sort(a.begin(), a.end()); }),
+           measure_ms([&] { parallel::sort(b); }));
+
+    a = data;
+    b = data;
+    auto square = [](long long x) { return x * x; };
+    report("transform", measure_ms([&] { std::transform(a.begin(), a.end(), a.begin(), square); }),
+           measure_ms([&] { parallel::transform(b, square); }));
+
+    long long serial_sum = 0, parallel_sum = 0;
+    report("reduce", measure_ms([&] { serial_sum = std::reduce(data.begin(), data.end(), 0LL); }),
+           measure_ms([&] { parallel_sum = parallel::reduce(data, 0LL); }));
+
+    a = data;
+    b = data;
+    report("inclusive_scan", measure_ms([&] { std::inclusive_scan(a.begin(), a.end(), a.begin()); }),
+           measure_ms([&] { parallel::inclusive_scan(b); }));
+
+    a = data;
+    b = data;
+    auto even = [](long long x) { return x % 2 == 0; };
+    report("partition", measure_ms([&] { std::stable_partition(a.begin(), a.end(), even); }),
+           measure_ms([&] { parallel::partition(b, even); }));
+
+    return serial_sum == parallel_sum ? 0 : 1;
+}
@@ -0,0 +1,305 @@
+#ifndef CONCURRENT_VECTOR_H
+#define CONCURRENT_VECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "vector.h"
+
+namespace my_cont {
+    // Append-only vector for many concurrent producers. Storage is a table of segments whose
+    // sizes double (64, 128, 256, ...), so elements never move and references stay valid.
+    // push_back claims an index with one fetch_add, installs its segment with at most one CAS
+    // and publishes the element through a per-slot flag, so it finishes in a bounded number of
+    // steps. Readers take a snapshot(): the longest prefix of slots that are all settled.
+    //
+    // If an element constructor throws, its slot becomes a tombstone: it still counts in
+    // size(), but iteration skips it and Snapshot::at() rejects it. If a segment cannot be
+    // allocated after an index in it was claimed, the whole segment is poisoned: each of its
+    // indices is a tombstone and every push that lands there throws std::bad_alloc.
+    template<typename T>
+    class ConcurrentVector : public Container<T> {
+    private:
+        static constexpr size_t FIRST_SEGMENT_BITS = 6;
+        static constexpr size_t FIRST_SEGMENT = size_t(1) << FIRST_SEGMENT_BITS;
+        static constexpr size_t SEGMENTS = sizeof(size_t) * 8 - FIRST_SEGMENT_BITS;
+        // One past the last index of the last segment.
+        static constexpr size_t MAX_ELEMENTS = size_t(0) - FIRST_SEGMENT;
+
+        enum : unsigned char { EMPTY, READY, FAILED };
+
+        struct Slot {
+            alignas(T) unsigned char storage[sizeof(T)];
+            std::atomic<unsigned char> state{EMPTY};
+
+            T* item() noexcept {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        std::atomic<Slot*> segments[SEGMENTS] = {};
+        std::atomic<size_t> claimed{0};
+        mutable std::atomic<size_t> published{0};
+
+        static size_t segment_of(size_t index) noexcept {
+            return static_cast<size_t>(std::bit_width(index + FIRST_SEGMENT)) - 1 - FIRST_SEGMENT_BITS;
+        }
+
+        static size_t segment_size(size_t segment) noexcept {
+            return FIRST_SEGMENT << segment;
+        }
+
+        static size_t offset_in_segment(size_t index, size_t segment) noexcept {
+            return index + FIRST_SEGMENT - segment_size(segment);
+        }
+
+        // Stands in for a segment whose allocation failed; never dereferenced.
+        static Slot* poisoned() noexcept {
+            static Slot marker;
+            return &marker;
+        }
+
+        // Installs segment k, or returns the one another thread installed first. Returns
+        // nullptr if the allocation fails.
+        Slot* install_segment(size_t k) noexcept {
+            Slot* seg = segments[k].load(std::memory_order_acquire);
+            if (seg != nullptr) {
+                return seg;
+            }
+            Slot* fresh = new (std::nothrow) Slot[segment_size(k)];
+            if (fresh == nullptr) {
+                return nullptr;
+            }
+            if (segments[k].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel)) {
+                return fresh;
+            }
+            delete[] fresh;
+            return seg;
+        }
+
+        // nullptr while the segment is missing or poisoned.
+        Slot* find_slot(size_t index) const noexcept {
+            size_t k = segment_of(index);
+            Slot* seg = segments[k].load(std::memory_order_acquire);
+            return seg && seg != poisoned() ? seg + offset_in_segment(index, k) : nullptr;
+        }
+
+        Slot& slot(size_t index) const noexcept {
+            size_t k = segment_of(index);
+            return segments[k].load(std::memory_order_acquire)[offset_in_segment(index, k)];
+        }
+
+        // Moves the published watermark over every slot that has been settled since.
+        size_t publish() const noexcept {
+            size_t current = published.load(std::memory_order_acquire);
+            size_t limit = claimed.load(std::memory_order_acquire);
+            size_t next = current;
+            while (next < limit) {
+                size_t k = segment_of(next);
+                Slot* seg = segments[k].load(std::memory_order_acquire);
+                if (seg == poisoned()) {
+                    // Every claimed index of a poisoned segment is a tombstone.
+                    next = std::min(limit, 2 * segment_size(k) - FIRST_SEGMENT);
+                    continue;
+                }
+                if (seg == nullptr ||
+                    seg[offset_in_segment(next, k)].state.load(std::memory_order_acquire) == EMPTY) {
+                    break;
+                }
+                ++next;
+            }
+            while (next > current &&
+                   !published.compare_exchange_weak(current, next, std::memory_order_acq_rel)) {
+            }
+            return std::max(current, next);
+        }
+
+    public:
+        class Snapshot {
+        private:
+            const ConcurrentVector* owner;
+            size_t count;
+
+        public:
+            class iterator {
+            private:
+                const ConcurrentVector* owner = nullptr;
+                size_t pos = 0;
+                size_t count = 0;
+
+                void skip_tombstones() noexcept {
+                    while (pos < count && !owner->holds(pos)) {
+                        ++pos;
+                    }
+                }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                iterator() = default;
+                iterator(const ConcurrentVector* owner, size_t pos, size_t count)
+                    : owner(owner), pos(pos), count(count) {
+                    skip_tombstones();
+                }
+
+                reference operator*() const {
+                    return (*owner)[pos];
+                }
+
+                pointer operator->() const {
+                    return &(*owner)[pos];
+                }
+
+                iterator& operator++() {
+                    ++pos;
+                    skip_tombstones();
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator tmp = *this;
+                    ++(*this);
+                    return tmp;
+                }
+
+                bool operator==(const iterator& other) const {
+                    return pos == other.pos;
+                }
+            };
+
+            Snapshot(const ConcurrentVector* owner, size_t count) : owner(owner), count(count) {}
+
+            [[nodiscard]] size_t size() const noexcept {
+                return count;
+            }
+
+            [[nodiscard]] bool empty() const noexcept {
+                return count == 0;
+            }
+
+            const T& operator[](size_t pos) const {
+                return (*owner)[pos];
+            }
+
+            const T& at(size_t pos) const {
+                if (pos >= count) throw std::out_of_range("ConcurrentVector::Snapshot::at - index out of range");
+                if (!owner->holds(pos)) throw std::out_of_range("ConcurrentVector::Snapshot::at - element was never constructed");
+                return (*owner)[pos];
+            }
+
+            // Skips tombstones.
+            iterator begin() const {
+                return iterator(owner, 0, count);
+            }
+
+            iterator end() const {
+                return iterator(owner, count, count);
+            }
+        };
+
+        ConcurrentVector() = default;
+
+        ConcurrentVector(const ConcurrentVector&) = delete;
+        ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+        ~ConcurrentVector() override {
+            size_t n = claimed.load(std::memory_order_acquire);
+            for (size_t i = 0; i < n; ++i) {
+                Slot* s = find_slot(i);
+                if (s != nullptr && s->state.load(std::memory_order_relaxed) == READY) {
+                    std::destroy_at(s->item());
+                }
+            }
+            for (auto& seg : segments) {
+                Slot* p = seg.load(std::memory_order_relaxed);
+                if (p != poisoned()) {
+                    delete[] p;
+                }
+            }
+        }
+
+        // Safe to call from any number of threads; returns the new element's address-stable slot.
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
+            size_t index = claimed.fetch_add(1, std::memory_order_acq_rel);
+            if (index >= MAX_ELEMENTS) throw std::length_error("ConcurrentVector::push_back - too many elements");
+            size_t k = segment_of(index);
+            Slot* seg = install_segment(k);
+            if (seg == nullptr) {
+                // The index is already claimed, so the segment must settle one way or the other.
+                if (segments[k].compare_exchange_strong(seg, poisoned(), std::memory_order_acq_rel)) {
+                    throw std::bad_alloc();
+                }
+            }
+            if (seg == poisoned()) throw std::bad_alloc();
+            Slot& s = seg[offset_in_segment(index, k)];
+            try {
+                ::new (static_cast<void*>(s.storage)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                s.state.store(FAILED, std::memory_order_release);
+                throw;
+            }
+            s.state.store(READY, std::memory_order_release);
+            return *s.item();
+        }
+
+        T& push_back(const T& value) {
+            return emplace_back(value);
+        }
+
+        T& push_back(T&& value) {
+            return emplace_back(std::move(value));
+        }
+
+        // Allocates the segments needed for n elements up front.
+        void reserve(size_t n) {
+            if (n == 0) {
+                return;
+            }
+            if (n > MAX_ELEMENTS) throw std::length_error("ConcurrentVector::reserve - too many elements");
+            for (size_t k = 0; k <= segment_of(n - 1); ++k) {
+                if (install_segment(k) == nullptr) throw std::bad_alloc();
+            }
+        }
+
+        // Unchecked: index must come from a snapshot or belong to an element this thread pushed.
+        T& operator[](size_t pos) {
+            return *slot(pos).item();
+        }
+
+        const T& operator[](size_t pos) const {
+            return *slot(pos).item();
+        }
+
+        // False for a published slot whose constructor threw.
+        [[nodiscard]] bool holds(size_t pos) const noexcept {
+            Slot* s = find_slot(pos);
+            return s != nullptr && s->state.load(std::memory_order_acquire) == READY;
+        }
+
+        [[nodiscard]] Snapshot snapshot() const noexcept {
+            return Snapshot(this, publish());
+        }
+
+        // Number of slots in the published prefix, tombstones included.
+        [[nodiscard]] size_t size() const override {
+            return publish();
+        }
+
+        [[nodiscard]] bool empty() const override {
+            return size() == 0;
+        }
+    };
+}
+
+#endif // CONCURRENT_VECTOR_H
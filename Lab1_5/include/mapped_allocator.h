@@ -0,0 +1,121 @@
+#ifndef MAPPED_ALLOCATOR_H
+#define MAPPED_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "vector.h"
+
+namespace my_cont {
+    // Allocator for very large, append-mostly vectors. Every allocation reserves a big range of
+    // address space up front (PROT_NONE, MAP_NORESERVE) and only commits the pages that are
+    // actually requested. Vector calls expand() before reallocating, so growth inside the
+    // reservation just commits more pages and never moves the elements.
+    template<typename T>
+    class MappedAllocator {
+    private:
+        size_t reserve_bytes_;
+        bool huge_pages_;
+
+        template<typename U>
+        friend class MappedAllocator;
+
+        static size_t page_size() {
+            static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        static size_t round_to_page(size_t bytes) {
+            size_t page = page_size();
+            return (bytes + page - 1) / page * page;
+        }
+
+        static void commit(void* from, size_t bytes) {
+            if (bytes != 0 && mprotect(from, bytes, PROT_READ | PROT_WRITE) != 0) {
+                throw std::bad_alloc();
+            }
+        }
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        static constexpr size_t DEFAULT_RESERVE = size_t(1) << 36;
+
+        explicit MappedAllocator(size_t reserve_bytes = DEFAULT_RESERVE, bool huge_pages = false) noexcept
+            : reserve_bytes_(round_to_page(reserve_bytes)), huge_pages_(huge_pages) {}
+
+        template<typename U>
+        MappedAllocator(const MappedAllocator<U>& other) noexcept
+            : reserve_bytes_(other.reserve_bytes_), huge_pages_(other.huge_pages_) {}
+
+        T* allocate(size_t n) {
+            if (n > max_size()) {
+                throw std::bad_array_new_length();
+            }
+            void* p = mmap(nullptr, reserve_bytes_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+#ifdef MADV_HUGEPAGE
+            if (huge_pages_) {
+                madvise(p, reserve_bytes_, MADV_HUGEPAGE);
+            }
+#endif
+            try {
+                commit(p, round_to_page(n * sizeof(T)));
+            } catch (...) {
+                munmap(p, reserve_bytes_);
+                throw;
+            }
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, size_t) noexcept {
+            munmap(p, reserve_bytes_);
+        }
+
+        // Grows an allocation in place by committing more of its reservation.
+        // Returns false when the new size does not fit, leaving the allocation untouched.
+        bool expand(T* p, size_t old_n, size_t new_n) {
+            size_t committed = round_to_page(old_n * sizeof(T));
+            size_t wanted = round_to_page(new_n * sizeof(T));
+            if (wanted > reserve_bytes_) {
+                return false;
+            }
+            if (wanted > committed) {
+                if (mprotect(reinterpret_cast<char*>(p) + committed, wanted - committed,
+                             PROT_READ | PROT_WRITE) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] size_t max_size() const noexcept {
+            return reserve_bytes_ / sizeof(T);
+        }
+
+        [[nodiscard]] size_t reserve_bytes() const noexcept {
+            return reserve_bytes_;
+        }
+
+        [[nodiscard]] bool huge_pages() const noexcept {
+            return huge_pages_;
+        }
+
+        template<typename U>
+        bool operator==(const MappedAllocator<U>& other) const noexcept {
+            return reserve_bytes_ == other.reserve_bytes_;
+        }
+    };
+
+    template<typename T, typename Growth = PageGrowth>
+    using MappedVector = Vector<T, MappedAllocator<T>, Growth>;
+}
+
+#endif // MAPPED_ALLOCATOR_H
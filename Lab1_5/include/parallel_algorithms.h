@@ -0,0 +1,254 @@
+#ifndef PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "vector.h"
+
+namespace my_cont {
+    class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::queue<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable ready;
+        bool stopping = false;
+
+        void work() {
+            for (;;) {
+                std::function<void()> task;
+                {
+                    std::unique_lock lock(mutex);
+                    ready.wait(lock, [this] { return stopping || !tasks.empty(); });
+                    if (tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop();
+                }
+                task();
+            }
+        }
+
+    public:
+        explicit ThreadPool(size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+            workers.reserve(threads);
+            for (size_t i = 0; i < threads; ++i) {
+                workers.emplace_back([this] { work(); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            ready.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept {
+            return workers.size();
+        }
+
+        template<typename F>
+        std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& f) {
+            using result_type = std::invoke_result_t<std::decay_t<F>>;
+            auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(f));
+            std::future<result_type> result = task->get_future();
+            {
+                std::lock_guard lock(mutex);
+                if (stopping) throw std::runtime_error("ThreadPool::submit - pool is shutting down");
+                tasks.emplace([task] { (*task)(); });
+            }
+            ready.notify_one();
+            return result;
+        }
+
+        static ThreadPool& shared() {
+            static ThreadPool pool;
+            return pool;
+        }
+    };
+
+    namespace parallel {
+        // Ranges smaller than this are not worth handing to another thread.
+        inline constexpr size_t MIN_CHUNK = 1 << 14;
+
+        namespace detail {
+            inline size_t chunk_count(size_t n, const ThreadPool& pool) {
+                return std::clamp<size_t>(n / MIN_CHUNK, 1, pool.size() + 1);
+            }
+
+            inline size_t chunk_begin(size_t chunk, size_t chunks, size_t n) {
+                return n / chunks * chunk + std::min(chunk, n % chunks);
+            }
+
+            // Runs fn(chunk, first, last) for every chunk; chunk 0 runs on the calling thread.
+            // Tasks never block on the pool themselves, so there is no nested waiting.
+            template<typename F>
+            void for_chunks(ThreadPool& pool, size_t n, size_t chunks, F fn) {
+                std::vector<std::future<void>> pending;
+                pending.reserve(chunks);
+                std::exception_ptr error;
+                try {
+                    for (size_t c = 1; c < chunks; ++c) {
+                        size_t first = chunk_begin(c, chunks, n);
+                        size_t last = chunk_begin(c + 1, chunks, n);
+                        pending.push_back(pool.submit([&fn, c, first, last] { fn(c, first, last); }));
+                    }
+                    fn(size_t{0}, size_t{0}, chunk_begin(1, chunks, n));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                for (auto& f : pending) {
+                    try {
+                        f.get();
+                    } catch (...) {
+                        if (!error) error = std::current_exception();
+                    }
+                }
+                if (error) std::rethrow_exception(error);
+            }
+
+            // Folds neighbouring chunks together in log2(chunks) parallel rounds.
+            // combine(first, mid, last) merges [first, mid) and [mid, last) and returns its
+            // result for the whole range; results[i] holds the value for chunk i.
+            template<typename R, typename Combine>
+            R combine_rounds(ThreadPool& pool, size_t n, std::vector<R> results, Combine combine) {
+                size_t chunks = results.size();
+                for (size_t width = 1; width < chunks; width *= 2) {
+                    size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+                    for_chunks(pool, pairs, pairs, [&](size_t, size_t first_pair, size_t last_pair) {
+                        for (size_t p = first_pair; p < last_pair; ++p) {
+                            size_t left = 2 * width * p;
+                            size_t right = left + width;
+                            if (right >= chunks) continue;
+                            size_t end = std::min(right + width, chunks);
+                            results[left] = combine(chunk_begin(left, chunks, n), chunk_begin(right, chunks, n),
+                                                    chunk_begin(end, chunks, n), results[left], results[right]);
+                        }
+                    });
+                }
+                return results[0];
+            }
+        }
+
+        template<typename T, typename A, typename G, typename Compare = std::less<>>
+        void sort(Vector<T, A, G>& v, Compare comp = {}, ThreadPool& pool = ThreadPool::shared()) {
+            size_t chunks = detail::chunk_count(v.size(), pool);
+            T* base = v.data();
+            detail::for_chunks(pool, v.size(), chunks, [&](size_t, size_t first, size_t last) {
+                std::sort(base + first, base + last, comp);
+            });
+            detail::combine_rounds(pool, v.size(), std::vector<char>(chunks),
+                                   [&](size_t first, size_t mid, size_t last, char, char) {
+                                       std::inplace_merge(base + first, base + mid, base + last, comp);
+                                       return char{};
+                                   });
+        }
+
+        template<typename T, typename A, typename G, typename F>
+        void transform(Vector<T, A, G>& v, F f, ThreadPool& pool = ThreadPool::shared()) {
+            T* base = v.data();
+            detail::for_chunks(pool, v.size(), detail::chunk_count(v.size(), pool),
+                               [&](size_t, size_t first, size_t last) {
+                                   std::transform(base + first, base + last, base + first, f);
+                               });
+        }
+
+        template<typename T, typename A, typename G, typename U, typename UA, typename UG, typename F>
+        void transform(const Vector<T, A, G>& in, Vector<U, UA, UG>& out, F f,
+                       ThreadPool& pool = ThreadPool::shared()) {
+            out.resize(in.size());
+            const T* src = in.data();
+            U* dst = out.data();
+            detail::for_chunks(pool, in.size(), detail::chunk_count(in.size(), pool),
+                               [&](size_t, size_t first, size_t last) {
+                                   std::transform(src + first, src + last, dst + first, f);
+                               });
+        }
+
+        // op must be associative; chunk results are combined left to right.
+        template<typename T, typename A, typename G, typename R, typename Op = std::plus<>>
+        R reduce(const Vector<T, A, G>& v, R init, Op op = {}, ThreadPool& pool = ThreadPool::shared()) {
+            size_t chunks = detail::chunk_count(v.size(), pool);
+            if (v.empty()) {
+                return init;
+            }
+            std::vector<R> partial(chunks);
+            const T* base = v.data();
+            detail::for_chunks(pool, v.size(), chunks, [&](size_t c, size_t first, size_t last) {
+                R acc = base[first];
+                for (size_t i = first + 1; i < last; ++i) {
+                    acc = op(std::move(acc), base[i]);
+                }
+                partial[c] = std::move(acc);
+            });
+            for (auto& value : partial) {
+                init = op(std::move(init), std::move(value));
+            }
+            return init;
+        }
+
+        template<typename T, typename A, typename G, typename Op = std::plus<>>
+        void inclusive_scan(Vector<T, A, G>& v, Op op = {}, ThreadPool& pool = ThreadPool::shared()) {
+            size_t chunks = detail::chunk_count(v.size(), pool);
+            T* base = v.data();
+            detail::for_chunks(pool, v.size(), chunks, [&](size_t, size_t first, size_t last) {
+                std::inclusive_scan(base + first, base + last, base + first, op);
+            });
+            if (chunks == 1) {
+                return;
+            }
+            std::vector<T> carry;
+            carry.reserve(chunks);
+            carry.push_back(base[detail::chunk_begin(1, chunks, v.size()) - 1]);
+            for (size_t c = 1; c + 1 < chunks; ++c) {
+                carry.push_back(op(carry.back(), base[detail::chunk_begin(c + 1, chunks, v.size()) - 1]));
+            }
+            detail::for_chunks(pool, v.size(), chunks, [&](size_t c, size_t first, size_t last) {
+                if (c == 0) return;
+                for (size_t i = first; i < last; ++i) {
+                    base[i] = op(carry[c - 1], base[i]);
+                }
+            });
+        }
+
+        // Stable partition; returns the index of the first element for which pred is false.
+        template<typename T, typename A, typename G, typename Pred>
+        size_t partition(Vector<T, A, G>& v, Pred pred, ThreadPool& pool = ThreadPool::shared()) {
+            size_t chunks = detail::chunk_count(v.size(), pool);
+            std::vector<size_t> mids(chunks);
+            T* base = v.data();
+            detail::for_chunks(pool, v.size(), chunks, [&](size_t c, size_t first, size_t last) {
+                mids[c] = static_cast<size_t>(std::stable_partition(base + first, base + last, pred) - base);
+            });
+            return detail::combine_rounds(pool, v.size(), std::move(mids),
+                                          [&](size_t, size_t mid, size_t, size_t left_mid, size_t right_mid) {
+                                              std::rotate(base + left_mid, base + mid, base + right_mid);
+                                              return left_mid + (right_mid - mid);
+                                          });
+        }
+    }
+}
+
+#endif // PARALLEL_ALGORITHMS_H
@@ -0,0 +1,282 @@
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "vector.h"
+
+namespace my_cont {
+    // Structure-of-arrays sibling of Vector: every field lives in its own contiguous Vector,
+    // rows are addressed through tuples of references.
+    template<typename... Fields>
+    class SoaVector : public Container<std::tuple<Fields...>> {
+        static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field");
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields&...>;
+        using const_reference = std::tuple<const Fields&...>;
+
+        template<size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+    private:
+        using indices = std::index_sequence_for<Fields...>;
+
+        std::tuple<Vector<Fields>...> columns;
+
+        template<typename Row, size_t... I>
+        void push_row(std::index_sequence<I...>, Row&& row) {
+            size_t pushed = 0;
+            try {
+                ((std::get<I>(columns).push_back(std::get<I>(std::forward<Row>(row))), ++pushed), ...);
+            } catch (...) {
+                ((I < pushed ? std::get<I>(columns).pop_back() : void()), ...);
+                throw;
+            }
+        }
+
+        template<size_t... I>
+        reference row(std::index_sequence<I...>, size_t pos) {
+            return reference(std::get<I>(columns)[pos]...);
+        }
+
+        template<size_t... I>
+        const_reference row(std::index_sequence<I...>, size_t pos) const {
+            return const_reference(std::get<I>(columns)[pos]...);
+        }
+
+        template<typename F>
+        void for_each_column(F&& f) {
+            std::apply([&](auto&... column) { (f(column), ...); }, columns);
+        }
+
+        template<typename Owner, typename Ref>
+        class basic_iterator {
+        private:
+            Owner* owner = nullptr;
+            size_t pos = 0;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::tuple<Fields...>;
+            using difference_type = std::ptrdiff_t;
+            using reference = Ref;
+
+            basic_iterator() = default;
+            basic_iterator(Owner* owner, size_t pos) : owner(owner), pos(pos) {}
+
+            reference operator*() const {
+                return (*owner)[pos];
+            }
+
+            reference operator[](difference_type n) const {
+                return (*owner)[pos + n];
+            }
+
+            basic_iterator& operator++() {
+                ++pos;
+                return *this;
+            }
+
+            basic_iterator operator++(int) {
+                basic_iterator tmp = *this;
+                ++pos;
+                return tmp;
+            }
+
+            basic_iterator& operator--() {
+                --pos;
+                return *this;
+            }
+
+            basic_iterator operator--(int) {
+                basic_iterator tmp = *this;
+                --pos;
+                return tmp;
+            }
+
+            basic_iterator& operator+=(difference_type n) {
+                pos += n;
+                return *this;
+            }
+
+            basic_iterator& operator-=(difference_type n) {
+                pos -= n;
+                return *this;
+            }
+
+            basic_iterator operator+(difference_type n) const {
+                return basic_iterator(owner, pos + n);
+            }
+
+            basic_iterator operator-(difference_type n) const {
+                return basic_iterator(owner, pos - n);
+            }
+
+            difference_type operator-(const basic_iterator& other) const {
+                return static_cast<difference_type>(pos) - static_cast<difference_type>(other.pos);
+            }
+
+            bool operator==(const basic_iterator& other) const {
+                return pos == other.pos;
+            }
+
+            auto operator<=>(const basic_iterator& other) const {
+                return pos <=> other.pos;
+            }
+        };
+
+    public:
+        using iterator = basic_iterator<SoaVector, reference>;
+        using const_iterator = basic_iterator<const SoaVector, const_reference>;
+
+        SoaVector() = default;
+
+        SoaVector(std::initializer_list<value_type> init) {
+            reserve(init.size());
+            for (const auto& r : init) {
+                push_back(r);
+            }
+        }
+
+        reference operator[](size_t pos) {
+            return row(indices{}, pos);
+        }
+
+        const_reference operator[](size_t pos) const {
+            return row(indices{}, pos);
+        }
+
+        reference at(size_t pos) {
+            if (pos >= size()) throw std::out_of_range("SoaVector::at - index out of range");
+            return row(indices{}, pos);
+        }
+
+        const_reference at(size_t pos) const {
+            if (pos >= size()) throw std::out_of_range("SoaVector::at - index out of range");
+            return row(indices{}, pos);
+        }
+
+        reference front() {
+            if (empty()) throw std::out_of_range("SoaVector::front - empty vector");
+            return row(indices{}, 0);
+        }
+
+        reference back() {
+            if (empty()) throw std::out_of_range("SoaVector::back - empty vector");
+            return row(indices{}, size() - 1);
+        }
+
+        // Contiguous storage of one field; loops over a single column vectorize like a plain array.
+        template<size_t I>
+        std::span<field_type<I>> column() noexcept {
+            auto& c = std::get<I>(columns);
+            return std::span<field_type<I>>(c.data(), c.size());
+        }
+
+        template<size_t I>
+        std::span<const field_type<I>> column() const noexcept {
+            const auto& c = std::get<I>(columns);
+            return std::span<const field_type<I>>(c.data(), c.size());
+        }
+
+        iterator begin() noexcept {
+            return iterator(this, 0);
+        }
+
+        iterator end() noexcept {
+            return iterator(this, size());
+        }
+
+        const_iterator begin() const noexcept {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const noexcept {
+            return const_iterator(this, size());
+        }
+
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        [[nodiscard]] bool empty() const override {
+            return size() == 0;
+        }
+
+        [[nodiscard]] size_t size() const override {
+            return std::get<0>(columns).size();
+        }
+
+        [[nodiscard]] size_t capacity() const {
+            return std::get<0>(columns).capacity();
+        }
+
+        void reserve(size_t new_capacity) {
+            for_each_column([&](auto& column) { column.reserve(new_capacity); });
+        }
+
+        void shrink_to_fit() {
+            for_each_column([](auto& column) { column.shrink_to_fit(); });
+        }
+
+        void clear() {
+            for_each_column([](auto& column) { column.clear(); });
+        }
+
+        void push_back(const value_type& value) {
+            push_row(indices{}, value);
+        }
+
+        void push_back(value_type&& value) {
+            push_row(indices{}, std::move(value));
+        }
+
+        template<typename... Args>
+            requires (sizeof...(Args) == sizeof...(Fields))
+        void emplace_back(Args&&... args) {
+            push_row(indices{}, std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        void pop_back() {
+            if (empty()) throw std::out_of_range("SoaVector::pop_back - empty vector");
+            for_each_column([](auto& column) { column.pop_back(); });
+        }
+
+        void erase(size_t index) {
+            if (index >= size()) throw std::out_of_range("SoaVector::erase - index out of range");
+            for_each_column([&](auto& column) { column.erase(index); });
+        }
+
+        void resize(size_t count) {
+            for_each_column([&](auto& column) { column.resize(count); });
+        }
+
+        void swap(SoaVector& other) noexcept {
+            std::apply([&](auto&... mine) {
+                std::apply([&](auto&... theirs) { (mine.swap(theirs), ...); }, other.columns);
+            }, columns);
+        }
+
+        bool operator==(const SoaVector& other) const {
+            return columns == other.columns;
+        }
+
+        bool operator!=(const SoaVector& other) const {
+            return !(*this == other);
+        }
+    };
+}
+
+#endif // SOA_VECTOR_H
@@ -2,12 +2,68 @@
 #define VECTOR_H
 
 #include <cstddef>
+#include <cstring>
 #include <stdexcept>
 #include <algorithm>
 #include <initializer_list>
 #include <compare>
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace my_cont {
+    template<typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // Allocators that can grow a block in place opt into it with expand(p, old_n, new_n).
+    template<typename Alloc, typename T>
+    concept expandable_allocator = requires(Alloc& alloc, T* p, size_t n) {
+        { alloc.expand(p, n, n) } -> std::same_as<bool>;
+    };
+
+    // Growth policies decide the capacity of the next buffer once `required` elements
+    // no longer fit into `current`. The result is always at least `required`.
+    struct DoublingGrowth {
+        static constexpr size_t initial_capacity = 16;
+
+        static size_t next_capacity(size_t current, size_t required, size_t) {
+            size_t grown = current == 0 ? initial_capacity : current * 2;
+            return std::max(grown, required);
+        }
+    };
+
+    struct GoldenGrowth {
+        static constexpr size_t initial_capacity = 16;
+
+        static size_t next_capacity(size_t current, size_t required, size_t) {
+            size_t grown = current == 0 ? initial_capacity : current + current / 2;
+            return std::max(grown, required);
+        }
+    };
+
+    // Grows by 1.5x and then rounds the byte size up to what the allocator would hand out
+    // anyway: 16-byte granules for small blocks, whole pages for large ones.
+    struct PageGrowth {
+        static constexpr size_t initial_capacity = 16;
+        static constexpr size_t granule = 16;
+        static constexpr size_t page_size = 4096;
+
+        static size_t next_capacity(size_t current, size_t required, size_t elem_size) {
+            size_t grown = current == 0 ? initial_capacity : current + current / 2;
+            size_t bytes = std::max(grown, required) * elem_size;
+            size_t step = bytes < page_size ? granule : page_size;
+            bytes = (bytes + step - 1) / step * step;
+            return bytes / elem_size;
+        }
+    };
+
     template<typename T>
     class Container {
     public:
@@ -20,80 +76,381 @@ namespace my_cont {
         [[nodiscard]] virtual size_t size() const = 0;
     };
 
-    template<typename T>
-    class Vector : public Container<T> {
+    namespace detail {
+        // Raw storage for the first N elements of a SmallVector; empty for a plain Vector.
+        template<typename T, size_t N>
+        struct InlineBuffer {
+            alignas(T) unsigned char bytes[N * sizeof(T)];
+
+            T* data() noexcept {
+                return reinterpret_cast<T*>(bytes);
+            }
+
+            const T* data() const noexcept {
+                return reinterpret_cast<const T*>(bytes);
+            }
+        };
+
+        template<typename T>
+        struct InlineBuffer<T, 0> {
+            T* data() noexcept {
+                return nullptr;
+            }
+
+            const T* data() const noexcept {
+                return nullptr;
+            }
+        };
+    }
+
+    // Shared implementation of Vector (InlineN == 0) and SmallVector. Elements live in the
+    // object's inline buffer while they fit and on the heap after that; with InlineN == 0
+    // every inline branch is decided at compile time.
+    template<typename T, typename Allocator, typename Growth, size_t InlineN>
+    class VectorBase : public Container<T> {
+        static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, T>,
+                      "Allocator::value_type must match T");
+
+    public:
+        using allocator_type = Allocator;
+        using growth_policy = Growth;
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     private:
-        T* data_ = nullptr;
+        template<typename, typename, typename, size_t>
+        friend class VectorBase;
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        // Relocating elements into storage that is already there cannot throw.
+        static constexpr bool nothrow_relocatable =
+            is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+        [[no_unique_address]] detail::InlineBuffer<T, InlineN> inline_;
+        T* data_ = inline_.data();
         size_t len = 0;
-        size_t cap = 0;
-        static constexpr size_t DEFAULT_CAPACITY = 16;
+        size_t cap = InlineN;
+        [[no_unique_address]] Allocator alloc_ = Allocator();
+
+        T* allocate(size_t n) {
+            return n == 0 ? nullptr : std::to_address(alloc_traits::allocate(alloc_, n));
+        }
+
+        void deallocate(T* p, size_t n) {
+            if (p) {
+                alloc_traits::deallocate(alloc_, p, n);
+            }
+        }
+
+        template<typename... Args>
+        void construct_one(T* p, Args&&... args) {
+            alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+        }
+
+        void destroy_one(T* p) {
+            alloc_traits::destroy(alloc_, p);
+        }
+
+        void destroy_range(T* first, T* last) {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (; first != last; ++first) {
+                    destroy_one(first);
+                }
+            }
+        }
+
+        template<typename InputIt>
+        T* construct_range(InputIt first, InputIt last, T* dest) {
+            T* cur = dest;
+            try {
+                for (; first != last; ++first, ++cur) {
+                    construct_one(cur, *first);
+                }
+            } catch (...) {
+                destroy_range(dest, cur);
+                throw;
+            }
+            return cur;
+        }
+
+        void fill_range(T* first, T* last, const T& value) {
+            T* cur = first;
+            try {
+                for (; cur != last; ++cur) {
+                    construct_one(cur, value);
+                }
+            } catch (...) {
+                destroy_range(first, cur);
+                throw;
+            }
+        }
+
+        void relocate(T* first, T* last, T* dest) {
+            if constexpr (is_trivially_relocatable_v<T>) {
+                if (first != last) {
+                    std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                                static_cast<size_t>(last - first) * sizeof(T));
+                }
+            } else {
+                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                    construct_range(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+                } else {
+                    construct_range(first, last, dest);
+                }
+                destroy_range(first, last);
+            }
+        }
+
+        void move_bytes(size_t from, size_t to, size_t count) {
+            std::memmove(static_cast<void*>(data_ + to), static_cast<const void*>(data_ + from),
+                         count * sizeof(T));
+        }
+
+        void free_storage() {
+            if (!is_inline()) {
+                deallocate(data_, cap);
+            }
+        }
+
+        // Drops all elements and heap storage, falling back to the inline buffer (if any).
+        void release_storage() {
+            clear();
+            free_storage();
+            data_ = inline_.data();
+            cap = InlineN;
+        }
+
+        // Takes over other's heap buffer, or relocates its inline elements into this object.
+        template<size_t M>
+        void adopt_storage(VectorBase<T, Allocator, Growth, M>& other) {
+            if (other.is_inline()) {
+                reserve(other.len);
+                relocate(other.data_, other.data_ + other.len, data_);
+                len = other.len;
+                other.len = 0;
+                return;
+            }
+            free_storage();
+            data_ = other.data_;
+            len = other.len;
+            cap = other.cap;
+            other.data_ = other.inline_.data();
+            other.len = 0;
+            other.cap = M;
+        }
+
+        // At least one side keeps its elements inline. Both objects have an inline buffer of
+        // the same size, so elements are only relocated and nothing is allocated.
+        void swap_inline(VectorBase& other) {
+            VectorBase* small = is_inline() ? this : &other;
+            VectorBase* big = small == this ? &other : this;
+            if (!big->is_inline()) {
+                // big's inline buffer is unused: park small's elements there and hand over the heap.
+                relocate(small->data_, small->data_ + small->len, big->inline_.data());
+                small->data_ = big->data_;
+                small->cap = big->cap;
+                big->data_ = big->inline_.data();
+                big->cap = InlineN;
+            } else {
+                if (small->len > big->len) {
+                    std::swap(small, big);
+                }
+                std::swap_ranges(small->data_, small->data_ + small->len, big->data_);
+                relocate(big->data_ + small->len, big->data_ + big->len, small->data_ + small->len);
+            }
+            std::swap(small->len, big->len);
+        }
+
+        bool try_expand(size_t new_capacity) {
+            if constexpr (expandable_allocator<Allocator, T>) {
+                if (data_ != nullptr && !is_inline() && alloc_.expand(data_, cap, new_capacity)) {
+                    cap = new_capacity;
+                    return true;
+                }
+            }
+            return false;
+        }
 
         void reallocate(size_t new_capacity) {
-            T* new_data = new T[new_capacity];
-            for (size_t i = 0; i < len; ++i) {
-                new_data[i] = std::move(data_[i]);
+            bool to_inline = new_capacity <= InlineN;
+            if (to_inline && is_inline()) {
+                return;
+            }
+            if (new_capacity > cap && try_expand(new_capacity)) {
+                return;
+            }
+            T* new_data = to_inline ? inline_.data() : allocate(new_capacity);
+            try {
+                relocate(data_, data_ + len, new_data);
+            } catch (...) {
+                if (!to_inline) {
+                    deallocate(new_data, new_capacity);
+                }
+                throw;
             }
-            delete[] data_;
+            free_storage();
+            data_ = new_data;
+            cap = to_inline ? InlineN : new_capacity;
+        }
+
+        [[nodiscard]] size_t grown_capacity(size_t required) const {
+            size_t limit = std::max(required, static_cast<size_t>(alloc_traits::max_size(alloc_)));
+            return std::min(Growth::next_capacity(cap, required, sizeof(T)), limit);
+        }
+
+        void reserve_for(size_t extra) {
+            if (len + extra > cap) {
+                reallocate(grown_capacity(len + extra));
+            }
+        }
+
+        template<typename... Args>
+        void grow_and_append(Args&&... args) {
+            size_t new_capacity = grown_capacity(len + 1);
+            if (try_expand(new_capacity)) {
+                construct_one(data_ + len, std::forward<Args>(args)...);
+                ++len;
+                return;
+            }
+            T* new_data = allocate(new_capacity);
+            try {
+                construct_one(new_data + len, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate(data_, data_ + len, new_data);
+            } catch (...) {
+                destroy_one(new_data + len);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            free_storage();
             data_ = new_data;
             cap = new_capacity;
+            ++len;
+        }
+
+    protected:
+        [[nodiscard]] bool is_inline() const noexcept {
+            if constexpr (InlineN == 0) {
+                return false;
+            } else {
+                return data_ == inline_.data();
+            }
         }
 
     public:
-        Vector() = default;
+        VectorBase() = default;
 
-        Vector(std::initializer_list<T> init) {
+        explicit VectorBase(const Allocator& alloc) noexcept : alloc_(alloc) {}
+
+        VectorBase(std::initializer_list<T> init, const Allocator& alloc = Allocator()) : alloc_(alloc) {
             reserve(init.size());
-            for (const auto& item : init) {
-                push_back(item);
-            }
+            construct_range(init.begin(), init.end(), data_);
+            len = init.size();
         }
 
-        Vector(const Vector& other) {
+        VectorBase(const VectorBase& other)
+            : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
             reserve(other.len);
-            for (size_t i = 0; i < other.len; ++i) {
-                push_back(other.data_[i]);
-            }
+            construct_range(other.data_, other.data_ + other.len, data_);
+            len = other.len;
         }
 
-        Vector(Vector&& other) noexcept
-            : data_(other.data_), len(other.len), cap(other.cap) {
-            other.data_ = nullptr;
-            other.len = 0;
-            other.cap = 0;
+        VectorBase(const VectorBase& other, const Allocator& alloc) : alloc_(alloc) {
+            reserve(other.len);
+            construct_range(other.data_, other.data_ + other.len, data_);
+            len = other.len;
+        }
+
+        // Heap storage is taken over. Inline elements fit into this object's buffer of the same
+        // size, so they are relocated without allocating.
+        VectorBase(VectorBase&& other) noexcept(InlineN == 0 || nothrow_relocatable)
+            : alloc_(std::move(other.alloc_)) {
+            adopt_storage(other);
+        }
+
+        // Explicit conversions between Vector and SmallVector.
+        template<size_t M> requires (M != InlineN)
+        explicit VectorBase(const VectorBase<T, Allocator, Growth, M>& other)
+            : VectorBase(alloc_traits::select_on_container_copy_construction(other.get_allocator())) {
+            append(other.begin(), other.end());
+        }
+
+        template<size_t M> requires (M != InlineN)
+        explicit VectorBase(VectorBase<T, Allocator, Growth, M>&& other) : VectorBase(other.get_allocator()) {
+            adopt_storage(other);
         }
 
-        ~Vector() override {
-            delete[] data_;
+        ~VectorBase() override {
+            clear();
+            free_storage();
         }
 
-        Vector& operator=(const Vector& other) {
+        VectorBase& operator=(const VectorBase& other) {
             if (this != &other) {
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                    if (alloc_ != other.alloc_) {
+                        release_storage();
+                    }
+                    alloc_ = other.alloc_;
+                }
                 clear();
                 reserve(other.len);
-                for (size_t i = 0; i < other.len; ++i) {
-                    push_back(other.data_[i]);
-                }
+                construct_range(other.data_, other.data_ + other.len, data_);
+                len = other.len;
             }
             return *this;
         }
 
-        Vector& operator=(Vector&& other) noexcept {
-            if (this != &other) {
-                delete[] data_;
-                data_ = other.data_;
+        VectorBase& operator=(VectorBase&& other) noexcept(
+            (InlineN == 0 || nothrow_relocatable) &&
+            (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value)) {
+            if (this == &other) {
+                return *this;
+            }
+            clear();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                if (alloc_ != other.alloc_) {
+                    release_storage();
+                }
+                alloc_ = std::move(other.alloc_);
+                adopt_storage(other);
+            } else if (alloc_ == other.alloc_) {
+                adopt_storage(other);
+            } else {
+                // Storage owned by a foreign allocator can't be taken over; move the elements instead.
+                reserve(other.len);
+                construct_range(std::make_move_iterator(other.data_), std::make_move_iterator(other.data_ + other.len),
+                                data_);
                 len = other.len;
-                cap = other.cap;
-                other.data_ = nullptr;
-                other.len = 0;
-                other.cap = 0;
+                other.clear();
             }
             return *this;
         }
 
+        [[nodiscard]] allocator_type get_allocator() const noexcept {
+            return alloc_;
+        }
+
         T& operator[](size_t pos) {
             return data_[pos];
         }
 
+        const T& operator[](size_t pos) const {
+            return data_[pos];
+        }
+
         T& at(size_t pos) {
             if (pos >= len) {
                 throw std::out_of_range("Vector::at - index out of range");
@@ -101,20 +458,89 @@ namespace my_cont {
             return data_[pos];
         }
 
+        const T& at(size_t pos) const {
+            if (pos >= len) {
+                throw std::out_of_range("Vector::at - index out of range");
+            }
+            return data_[pos];
+        }
+
         T& front() {
             if (empty()) throw std::out_of_range("Vector::front - empty vector");
             return data_[0];
         }
 
+        const T& front() const {
+            if (empty()) throw std::out_of_range("Vector::front - empty vector");
+            return data_[0];
+        }
+
         T& back() {
             if (empty()) throw std::out_of_range("Vector::back - empty vector");
             return data_[len - 1];
         }
 
+        const T& back() const {
+            if (empty()) throw std::out_of_range("Vector::back - empty vector");
+            return data_[len - 1];
+        }
+
         T* data() noexcept {
             return data_;
         }
 
+        const T* data() const noexcept {
+            return data_;
+        }
+
+        iterator begin() noexcept {
+            return data_;
+        }
+
+        const_iterator begin() const noexcept {
+            return data_;
+        }
+
+        const_iterator cbegin() const noexcept {
+            return data_;
+        }
+
+        iterator end() noexcept {
+            return data_ + len;
+        }
+
+        const_iterator end() const noexcept {
+            return data_ + len;
+        }
+
+        const_iterator cend() const noexcept {
+            return data_ + len;
+        }
+
+        reverse_iterator rbegin() noexcept {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator crbegin() const noexcept {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend() noexcept {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const noexcept {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crend() const noexcept {
+            return const_reverse_iterator(begin());
+        }
+
         [[nodiscard]] bool empty() const override {
             return len == 0;
         }
@@ -140,63 +566,281 @@ namespace my_cont {
         }
 
         void clear() {
-            if (len == 0) {
-                return;
-            }
-            for (size_t i = 0; i < len; i++) {
-                data_[i].~T();
-            }
+            destroy_range(data_, data_ + len);
             len = 0;
         }
 
-        void push_back(const T& value) {
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
             if (len >= cap) {
-                reserve(cap == 0 ? DEFAULT_CAPACITY : cap * 2);
+                grow_and_append(std::forward<Args>(args)...);
+            } else {
+                construct_one(data_ + len, std::forward<Args>(args)...);
+                ++len;
             }
-            data_[len++] = value;
+            return data_[len - 1];
+        }
+
+        void push_back(const T& value) {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value) {
+            emplace_back(std::move(value));
         }
 
         void pop_back() {
             if (empty()) throw std::out_of_range("Vector::pop_back - empty vector");
             --len;
+            destroy_one(data_ + len);
         }
 
-        void insert(size_t index, const T& value) {
+        template<typename... Args>
+        T& emplace(size_t index, Args&&... args) {
+            if (index > len) throw std::out_of_range("Vector::emplace - index out of range");
+            if (index == len) {
+                return emplace_back(std::forward<Args>(args)...);
+            }
+            T tmp(std::forward<Args>(args)...);
             if (len >= cap) {
-                reserve(cap == 0 ? DEFAULT_CAPACITY : cap * 2);
+                reserve(grown_capacity(len + 1));
             }
-            for (size_t i = len; i > index; --i) {
-                data_[i] = data_[i - 1];
+            if constexpr (is_trivially_relocatable_v<T>) {
+                move_bytes(index, index + 1, len - index);
+                try {
+                    construct_one(data_ + index, std::move(tmp));
+                } catch (...) {
+                    move_bytes(index + 1, index, len - index);
+                    throw;
+                }
+            } else {
+                construct_one(data_ + len, std::move(data_[len - 1]));
+                std::move_backward(data_ + index, data_ + len - 1, data_ + len);
+                data_[index] = std::move(tmp);
             }
-            data_[index] = value;
             ++len;
+            return data_[index];
+        }
+
+        void insert(size_t index, const T& value) {
+            emplace(index, value);
+        }
+
+        void insert(size_t index, T&& value) {
+            emplace(index, std::move(value));
+        }
+
+        template<std::input_iterator InputIt>
+        void insert(size_t index, InputIt first, InputIt last) {
+            if (index > len) throw std::out_of_range("Vector::insert - index out of range");
+            if constexpr (std::forward_iterator<InputIt>) {
+                size_t count = static_cast<size_t>(std::distance(first, last));
+                if (count == 0) {
+                    return;
+                }
+                reserve_for(count);
+                size_t tail = len - index;
+                if constexpr (is_trivially_relocatable_v<T>) {
+                    move_bytes(index, index + count, tail);
+                    try {
+                        construct_range(first, last, data_ + index);
+                    } catch (...) {
+                        move_bytes(index + count, index, tail);
+                        throw;
+                    }
+                } else if (count <= tail) {
+                    construct_range(std::make_move_iterator(data_ + len - count), std::make_move_iterator(data_ + len),
+                                    data_ + len);
+                    std::move_backward(data_ + index, data_ + len - count, data_ + len);
+                    std::copy(first, last, data_ + index);
+                } else {
+                    InputIt mid = std::next(first, static_cast<std::ptrdiff_t>(tail));
+                    T* copied_end = construct_range(mid, last, data_ + len);
+                    try {
+                        construct_range(std::make_move_iterator(data_ + index), std::make_move_iterator(data_ + len),
+                                        copied_end);
+                    } catch (...) {
+                        destroy_range(data_ + len, copied_end);
+                        throw;
+                    }
+                    std::copy(first, mid, data_ + index);
+                }
+                len += count;
+            } else {
+                size_t old_len = len;
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+                std::rotate(data_ + index, data_ + old_len, data_ + len);
+            }
+        }
+
+        void insert(size_t index, size_t count, const T& value) {
+            if (index > len) throw std::out_of_range("Vector::insert - index out of range");
+            if (count == 0) {
+                return;
+            }
+            T tmp(value);
+            reserve_for(count);
+            size_t tail = len - index;
+            if constexpr (is_trivially_relocatable_v<T>) {
+                move_bytes(index, index + count, tail);
+                try {
+                    fill_range(data_ + index, data_ + index + count, tmp);
+                } catch (...) {
+                    move_bytes(index + count, index, tail);
+                    throw;
+                }
+            } else if (count <= tail) {
+                construct_range(std::make_move_iterator(data_ + len - count), std::make_move_iterator(data_ + len),
+                                data_ + len);
+                std::move_backward(data_ + index, data_ + len - count, data_ + len);
+                std::fill(data_ + index, data_ + index + count, tmp);
+            } else {
+                fill_range(data_ + len, data_ + index + count, tmp);
+                try {
+                    construct_range(std::make_move_iterator(data_ + index), std::make_move_iterator(data_ + len),
+                                    data_ + index + count);
+                } catch (...) {
+                    destroy_range(data_ + len, data_ + index + count);
+                    throw;
+                }
+                std::fill(data_ + index, data_ + len, tmp);
+            }
+            len += count;
+        }
+
+        void insert(size_t index, std::initializer_list<T> init) {
+            insert(index, init.begin(), init.end());
+        }
+
+        template<std::input_iterator InputIt>
+        void append(InputIt first, InputIt last) {
+            if constexpr (std::forward_iterator<InputIt>) {
+                size_t count = static_cast<size_t>(std::distance(first, last));
+                reserve_for(count);
+                construct_range(first, last, data_ + len);
+                len += count;
+            } else {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            }
+        }
+
+        void append(std::initializer_list<T> init) {
+            append(init.begin(), init.end());
         }
 
         void erase(size_t index) {
-            for (size_t i = index; i < len - 1; ++i) {
-                data_[i] = data_[i + 1];
+            if (index >= len) throw std::out_of_range("Vector::erase - index out of range");
+            if constexpr (is_trivially_relocatable_v<T>) {
+                destroy_one(data_ + index);
+                move_bytes(index + 1, index, len - index - 1);
+            } else {
+                std::move(data_ + index + 1, data_ + len, data_ + index);
+                destroy_one(data_ + len - 1);
             }
             --len;
         }
 
+        // Erases [first, last); the tail is shifted down once.
+        void erase(size_t first, size_t last) {
+            if (first > last || last > len) throw std::out_of_range("Vector::erase - range out of bounds");
+            if (first == last) {
+                return;
+            }
+            if constexpr (is_trivially_relocatable_v<T>) {
+                destroy_range(data_ + first, data_ + last);
+                move_bytes(last, first, len - last);
+            } else {
+                std::move(data_ + last, data_ + len, data_ + first);
+                destroy_range(data_ + len - (last - first), data_ + len);
+            }
+            len -= last - first;
+        }
+
+        // Removes every element matching pred in one pass, keeping the order of the rest.
+        // Returns the number of removed elements.
+        template<typename Pred>
+        size_t remove_if(Pred pred) {
+            size_t write = 0;
+            if constexpr (is_trivially_relocatable_v<T>) {
+                size_t read = 0;
+                try {
+                    for (; read < len; ++read) {
+                        if (pred(data_[read])) {
+                            destroy_one(data_ + read);
+                        } else {
+                            if (write != read) {
+                                move_bytes(read, write, 1);
+                            }
+                            ++write;
+                        }
+                    }
+                } catch (...) {
+                    move_bytes(read, write, len - read);
+                    len = write + (len - read);
+                    throw;
+                }
+            } else {
+                write = static_cast<size_t>(std::remove_if(data_, data_ + len, pred) - data_);
+                destroy_range(data_ + write, data_ + len);
+            }
+            size_t removed = len - write;
+            len = write;
+            return removed;
+        }
+
+        // O(1) erase that fills the hole with the last element; does not keep the order.
+        void swap_remove(size_t index) {
+            if (index >= len) throw std::out_of_range("Vector::swap_remove - index out of range");
+            if (index != len - 1) {
+                if constexpr (is_trivially_relocatable_v<T>) {
+                    destroy_one(data_ + index);
+                    move_bytes(len - 1, index, 1);
+                    --len;
+                    return;
+                } else {
+                    data_[index] = std::move(data_[len - 1]);
+                }
+            }
+            --len;
+            destroy_one(data_ + len);
+        }
+
         void resize(size_t count, const T& value = T()) {
             if (count > len) {
-                reserve(count);
-                for (size_t i = len; i < count; ++i) {
-                    push_back(value);
+                if (count > cap) {
+                    T tmp(value);
+                    reserve(count);
+                    fill_range(data_ + len, data_ + count, tmp);
+                } else {
+                    fill_range(data_ + len, data_ + count, value);
                 }
             } else {
-                len = count;
+                destroy_range(data_ + count, data_ + len);
             }
+            len = count;
         }
 
-        void swap(Vector& other) noexcept {
-            std::swap(data_, other.data_);
-            std::swap(len, other.len);
-            std::swap(cap, other.cap);
+        void swap(VectorBase& other) noexcept(InlineN == 0 || nothrow_relocatable) {
+            if (is_inline() || other.is_inline()) {
+                swap_inline(other);
+            } else {
+                std::swap(data_, other.data_);
+                std::swap(len, other.len);
+                std::swap(cap, other.cap);
+            }
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(alloc_, other.alloc_);
+            }
         }
 
-        bool operator==(const Vector& other) const {
+        // A Vector and a SmallVector with the same elements compare equal.
+        template<size_t M>
+        bool operator==(const VectorBase<T, Allocator, Growth, M>& other) const {
             if (len != other.len) return false;
             for (size_t i = 0; i < len; ++i) {
                 if (data_[i] != other.data_[i]) {
@@ -206,11 +850,12 @@ namespace my_cont {
             return true;
         }
 
-        bool operator!=(const Vector& other) const {
+        template<size_t M>
+        bool operator!=(const VectorBase<T, Allocator, Growth, M>& other) const {
             return !(*this == other);
         }
 
-        bool operator<(const Vector& other) const {
+        bool operator<(const VectorBase& other) const {
             size_t min_size = std::min(len, other.len);
             for (size_t i = 0; i < min_size; ++i) {
                 if (data_[i] < other.data_[i]) return true;
@@ -219,19 +864,19 @@ namespace my_cont {
             return len < other.len;
         }
 
-        bool operator<=(const Vector& other) const {
+        bool operator<=(const VectorBase& other) const {
             return !(other < *this);
         }
 
-        bool operator>(const Vector& other) const {
+        bool operator>(const VectorBase& other) const {
             return other < *this;
         }
 
-        bool operator>=(const Vector& other) const {
+        bool operator>=(const VectorBase& other) const {
             return !(*this < other);
         }
 
-        std::strong_ordering operator<=>(const Vector& other) const {
+        std::strong_ordering operator<=>(const VectorBase& other) const {
             size_t min_size = std::min(len, other.len);
             for (size_t i = 0; i < min_size; ++i) {
                 if (auto cmp = data_[i] <=> other.data_[i]; cmp != 0) {
@@ -242,6 +887,43 @@ namespace my_cont {
         }
     };
 
+    template<typename T, typename Allocator = std::allocator<T>, typename Growth = DoublingGrowth>
+    class Vector : public VectorBase<T, Allocator, Growth, 0> {
+    public:
+        using VectorBase<T, Allocator, Growth, 0>::VectorBase;
+    };
+
+    template<typename T, typename A, typename G, size_t N, typename Pred>
+    size_t erase_if(VectorBase<T, A, G, N>& v, Pred pred) {
+        return v.remove_if(pred);
+    }
+
+    template<typename T, typename A, typename G, size_t N, typename U>
+    size_t erase(VectorBase<T, A, G, N>& v, const U& value) {
+        return v.remove_if([&value](const T& elem) { return elem == value; });
+    }
+
+    // Holds up to N elements inside the object and spills to the heap after that. It is not a
+    // Vector: conversions in either direction are explicit and move or copy the elements.
+    template<typename T, size_t N, typename Allocator = std::allocator<T>, typename Growth = DoublingGrowth>
+    class SmallVector : public VectorBase<T, Allocator, Growth, N> {
+        static_assert(N > 0, "SmallVector needs at least one inline element");
+
+    public:
+        using VectorBase<T, Allocator, Growth, N>::VectorBase;
+
+        [[nodiscard]] bool is_small() const noexcept {
+            return this->is_inline();
+        }
+    };
+
+    namespace pmr {
+        template<typename T, typename Growth = DoublingGrowth>
+        using Vector = my_cont::Vector<T, std::pmr::polymorphic_allocator<T>, Growth>;
+
+        template<typename T, size_t N, typename Growth = DoublingGrowth>
+        using SmallVector = my_cont::SmallVector<T, N, std::pmr::polymorphic_allocator<T>, Growth>;
+    }
 }
 
 #endif // VECTOR_H
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "concurrent_vector.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace my_cont;
+
+TEST(ConcurrentVectorTest, SingleThreaded) {
+    ConcurrentVector<std::string> v;
+    EXPECT_TRUE(v.empty());
+    std::string& first = v.push_back("first");
+    for (int i = 0; i < 1000; ++i) {
+        v.emplace_back(std::to_string(i));
+    }
+    EXPECT_EQ(&first, &v[0]);
+    EXPECT_EQ(v.size(), 1001);
+    EXPECT_EQ(v[1000], "999");
+
+    auto snap = v.snapshot();
+    EXPECT_EQ(snap.size(), 1001);
+    EXPECT_EQ(snap.at(1), "0");
+    EXPECT_THROW(snap.at(1001), std::out_of_range);
+    EXPECT_THROW(v.reserve(std::numeric_limits<size_t>::max()), std::length_error);
+    EXPECT_EQ(std::count_if(snap.begin(), snap.end(), [](const std::string& s) { return s.size() == 3; }), 900);
+}
+
+TEST(ConcurrentVectorTest, ConcurrentProducers) {
+    constexpr int threads = 8;
+    constexpr int per_thread = 20000;
+    ConcurrentVector<long> v;
+    std::atomic<bool> done{false};
+    std::atomic<size_t> max_seen{0};
+
+    std::thread reader([&] {
+        while (!done.load()) {
+            auto snap = v.snapshot();
+            for (size_t i = 0; i < snap.size(); i += 997) {
+                EXPECT_GE(snap[i], 0);
+            }
+            max_seen = std::max(max_seen.load(), snap.size());
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&v, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                long& slot = v.push_back(static_cast<long>(t) * per_thread + i);
+                EXPECT_EQ(slot, static_cast<long>(t) * per_thread + i);
+            }
+        });
+    }
+    for (auto& p : producers) {
+        p.join();
+    }
+    done = true;
+    reader.join();
+
+    auto snap = v.snapshot();
+    ASSERT_EQ(snap.size(), static_cast<size_t>(threads * per_thread));
+    EXPECT_LE(max_seen.load(), snap.size());
+    std::vector<long> all(snap.begin(), snap.end());
+    std::sort(all.begin(), all.end());
+    for (size_t i = 0; i < all.size(); ++i) {
+        ASSERT_EQ(all[i], static_cast<long>(i));
+    }
+}
+
+struct Picky {
+    int value;
+    explicit Picky(int v) : value(v) {
+        if (v < 0) throw std::invalid_argument("negative");
+    }
+};
+
+TEST(ConcurrentVectorTest, FailedConstructionLeavesTombstone) {
+    ConcurrentVector<Picky> v;
+    v.reserve(100);
+    v.emplace_back(1);
+    EXPECT_THROW(v.emplace_back(-1), std::invalid_argument);
+    v.emplace_back(2);
+
+    auto snap = v.snapshot();
+    EXPECT_EQ(snap.size(), 3);
+    EXPECT_FALSE(v.holds(1));
+    EXPECT_THROW(snap.at(1), std::out_of_range);
+    EXPECT_EQ(snap.at(2).value, 2);
+    std::vector<int> values;
+    for (const Picky& p : snap) {
+        values.push_back(p.value);
+    }
+    EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
+TEST(ConcurrentVectorTest, ThrowsInTheMiddleOfARun) {
+    ConcurrentVector<Picky> v;
+    EXPECT_THROW(v.emplace_back(-1), std::invalid_argument);
+    int failed = 1;
+    for (int i = 1; i < 200; ++i) {
+        if (i % 17 == 0) {
+            EXPECT_THROW(v.emplace_back(-i), std::invalid_argument);
+            ++failed;
+        } else {
+            v.emplace_back(i);
+        }
+    }
+
+    auto snap = v.snapshot();
+    EXPECT_EQ(snap.size(), 200);
+    EXPECT_EQ(std::distance(snap.begin(), snap.end()), 200 - failed);
+    int expected = 1;
+    for (const Picky& p : snap) {
+        if (expected % 17 == 0) {
+            ++expected;
+        }
+        ASSERT_EQ(p.value, expected++);
+    }
+    EXPECT_EQ(expected, 200);
+}
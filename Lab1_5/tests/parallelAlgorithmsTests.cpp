@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "parallel_algorithms.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+
+using namespace my_cont;
+
+class ParallelAlgorithmsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> dist(-1000000, 1000000);
+        for (size_t i = 0; i < 200000; ++i) {
+            values.push_back(dist(gen));
+        }
+    }
+
+    ThreadPool pool{4};
+    Vector<int> values;
+};
+
+TEST_F(ParallelAlgorithmsTest, Iterators) {
+    Vector<int> v{3, 1, 2};
+    std::sort(v.begin(), v.end());
+    EXPECT_EQ(v, (Vector<int>{1, 2, 3}));
+    EXPECT_EQ(*v.rbegin(), 3);
+    EXPECT_EQ(std::accumulate(v.cbegin(), v.cend(), 0), 6);
+    EXPECT_EQ(v.end() - v.begin(), 3);
+}
+
+TEST_F(ParallelAlgorithmsTest, Sort) {
+    std::vector<int> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    parallel::sort(values, std::less<>(), pool);
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+
+    parallel::sort(values, std::greater<>(), pool);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+
+    Vector<std::string> small{"b", "c", "a"};
+    parallel::sort(small);
+    EXPECT_EQ(small, (Vector<std::string>{"a", "b", "c"}));
+}
+
+TEST_F(ParallelAlgorithmsTest, TransformAndReduce) {
+    long long expected = std::accumulate(values.begin(), values.end(), 0LL);
+    EXPECT_EQ(parallel::reduce(values, 0LL, std::plus<>(), pool), expected);
+
+    Vector<long long> squares;
+    parallel::transform(values, squares, [](int x) { return 1LL * x * x; }, pool);
+    ASSERT_EQ(squares.size(), values.size());
+    EXPECT_EQ(squares[1234], 1LL * values[1234] * values[1234]);
+
+    parallel::transform(values, [](int x) { return x / 2; }, pool);
+    EXPECT_EQ(parallel::reduce(Vector<int>{}, 5, std::plus<>(), pool), 5);
+}
+
+TEST_F(ParallelAlgorithmsTest, InclusiveScan) {
+    Vector<long long> wide;
+    for (int x : values) {
+        wide.push_back(x);
+    }
+    std::vector<long long> expected(wide.begin(), wide.end());
+    std::inclusive_scan(expected.begin(), expected.end(), expected.begin());
+    parallel::inclusive_scan(wide, std::plus<>(), pool);
+    EXPECT_TRUE(std::equal(wide.begin(), wide.end(), expected.begin(), expected.end()));
+}
+
+TEST_F(ParallelAlgorithmsTest, Partition) {
+    std::vector<int> expected(values.begin(), values.end());
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto mid = std::stable_partition(expected.begin(), expected.end(), is_even);
+
+    size_t point = parallel::partition(values, is_even, pool);
+    EXPECT_EQ(point, static_cast<size_t>(mid - expected.begin()));
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+}
+
+TEST_F(ParallelAlgorithmsTest, ExceptionsPropagate) {
+    int marker = values[values.size() - 1];
+    EXPECT_THROW(parallel::transform(values, [marker](int x) -> int {
+        if (x == marker) throw std::runtime_error("bad value");
+        return x;
+    }, pool), std::runtime_error);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "soa_vector.h"
+#include <numeric>
+#include <string>
+
+using namespace my_cont;
+
+class SoaVectorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        rows.push_back({1, 1.5, "one"});
+        rows.emplace_back(2, 2.5, "two");
+        rows.emplace_back(3, 3.5, std::string("three"));
+    }
+
+    SoaVector<int, double, std::string> rows;
+};
+
+TEST_F(SoaVectorTest, RowAccess) {
+    EXPECT_EQ(rows.size(), 3);
+    auto [id, weight, name] = rows[1];
+    EXPECT_EQ(id, 2);
+    EXPECT_DOUBLE_EQ(weight, 2.5);
+    EXPECT_EQ(name, "two");
+
+    name = "TWO";
+    std::get<0>(rows.back()) = 30;
+    EXPECT_EQ(std::get<2>(rows.at(1)), "TWO");
+    EXPECT_EQ(rows.column<0>()[2], 30);
+    EXPECT_THROW(rows.at(3), std::out_of_range);
+
+    rows[0] = std::make_tuple(10, 0.5, std::string("ten"));
+    EXPECT_EQ(rows.front(), std::make_tuple(10, 0.5, std::string("ten")));
+}
+
+TEST_F(SoaVectorTest, ColumnsAreContiguous) {
+    auto ids = rows.column<0>();
+    auto weights = rows.column<1>();
+    ASSERT_EQ(ids.size(), 3);
+    EXPECT_EQ(&ids[1], &ids[0] + 1);
+    EXPECT_DOUBLE_EQ(std::accumulate(weights.begin(), weights.end(), 0.0), 7.5);
+
+    for (double& w : rows.column<1>()) {
+        w *= 2;
+    }
+    EXPECT_DOUBLE_EQ(std::get<1>(rows[2]), 7.0);
+
+    const auto& view = rows;
+    EXPECT_EQ(view.column<2>()[0], "one");
+}
+
+TEST_F(SoaVectorTest, EraseAndIteration) {
+    rows.erase(0);
+    EXPECT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows.column<2>()[0], "two");
+    EXPECT_THROW(rows.erase(5), std::out_of_range);
+
+    int sum = 0;
+    for (auto [id, weight, name] : rows) {
+        sum += id;
+        weight = 0;
+    }
+    EXPECT_EQ(sum, 5);
+    EXPECT_DOUBLE_EQ(rows.column<1>()[1], 0.0);
+    EXPECT_EQ(rows.end() - rows.begin(), 2);
+
+    rows.pop_back();
+    rows.pop_back();
+    EXPECT_TRUE(rows.empty());
+    EXPECT_THROW(rows.pop_back(), std::out_of_range);
+}
+
+TEST_F(SoaVectorTest, CopySwapAndCompare) {
+    SoaVector<int, double, std::string> copy(rows);
+    EXPECT_EQ(copy, rows);
+    std::get<1>(copy[0]) = 100;
+    EXPECT_NE(copy, rows);
+
+    SoaVector<int, double, std::string> other{{7, 7.0, "seven"}};
+    other.swap(rows);
+    EXPECT_EQ(rows.size(), 1);
+    EXPECT_EQ(other.size(), 3);
+
+    other.reserve(100);
+    EXPECT_GE(other.capacity(), 100);
+    other.resize(5);
+    EXPECT_EQ(other.column<2>()[4], "");
+    other.clear();
+    EXPECT_TRUE(other.empty());
+}
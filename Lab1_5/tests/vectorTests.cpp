@@ -1,8 +1,89 @@
 #include <gtest/gtest.h>
 #include "vector.h"
+#include "mapped_allocator.h"
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <string>
 
 using namespace my_cont;
 
+struct Handle {
+    static inline int moves = 0;
+    std::unique_ptr<int> ptr;
+
+    explicit Handle(int v) : ptr(std::make_unique<int>(v)) {}
+    Handle(Handle&& other) noexcept : ptr(std::move(other.ptr)) { ++moves; }
+    Handle& operator=(Handle&& other) noexcept {
+        ptr = std::move(other.ptr);
+        ++moves;
+        return *this;
+    }
+};
+
+template<>
+struct my_cont::is_trivially_relocatable<Handle> : std::true_type {};
+
+struct ThrowingCopy {
+    int value;
+    explicit ThrowingCopy(int v) : value(v) {}
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (value < 0) throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+template<>
+struct my_cont::is_trivially_relocatable<ThrowingCopy> : std::true_type {};
+
+struct Tracked {
+    static inline int constructed = 0;
+    static inline int destroyed = 0;
+    int value;
+
+    Tracked() : value(0) { ++constructed; }
+    explicit Tracked(int v) : value(v) { ++constructed; }
+    Tracked(const Tracked& other) : value(other.value) { ++constructed; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++constructed; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { ++destroyed; }
+
+    static void reset() {
+        constructed = 0;
+        destroyed = 0;
+    }
+};
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    std::shared_ptr<long> live = std::make_shared<long>(0);
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept : live(other.live) {}
+
+    T* allocate(size_t n) {
+        *live += static_cast<long>(n);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        *live -= static_cast<long>(n);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>& other) const noexcept {
+        return live == other.live;
+    }
+};
+
 class VectorTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -181,6 +262,507 @@ TEST_F(VectorTest, ComparisonOperators) {
     EXPECT_EQ(v3 <=> v1, std::strong_ordering::less);
 }
 
+TEST_F(VectorTest, ReserveDoesNotConstruct) {
+    Tracked::reset();
+    {
+        Vector<Tracked> v;
+        v.reserve(1000);
+        EXPECT_EQ(Tracked::constructed, 0);
+        v.push_back(Tracked(1));
+        v.push_back(Tracked(2));
+        EXPECT_EQ(Tracked::constructed - Tracked::destroyed, 2);
+        v.clear();
+        EXPECT_EQ(Tracked::constructed, Tracked::destroyed);
+        EXPECT_EQ(v.capacity(), 1000);
+    }
+    EXPECT_EQ(Tracked::constructed, Tracked::destroyed);
+}
+
+TEST_F(VectorTest, ElementLifetimes) {
+    Tracked::reset();
+    {
+        Vector<Tracked> v;
+        for (int i = 0; i < 40; ++i) {
+            v.push_back(Tracked(i));
+        }
+        v.insert(3, Tracked(100));
+        v.erase(0);
+        v.pop_back();
+        v.resize(50, Tracked(7));
+        v.resize(10);
+        v.shrink_to_fit();
+        EXPECT_EQ(Tracked::constructed - Tracked::destroyed, 10);
+        EXPECT_EQ(v[2].value, 100);
+        EXPECT_EQ(v[3].value, 3);
+
+        Vector<Tracked> copy(v);
+        copy = v;
+        EXPECT_EQ(Tracked::constructed - Tracked::destroyed, 20);
+    }
+    EXPECT_EQ(Tracked::constructed, Tracked::destroyed);
+}
+
+TEST_F(VectorTest, PushBackOwnElementOnGrowth) {
+    Vector<std::string> v;
+    v.push_back("first element long enough to allocate");
+    v.shrink_to_fit();
+    v.push_back(v[0]);
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[1], v[0]);
+    v.insert(0, v[1]);
+    EXPECT_EQ(v[0], v[2]);
+}
+
+TEST_F(VectorTest, InsertEraseOutOfRange) {
+    EXPECT_THROW(int_vec.insert(4, 1), std::out_of_range);
+    EXPECT_THROW(empty_vec.erase(0), std::out_of_range);
+}
+
+TEST_F(VectorTest, EmplaceBackAndMovePushBack) {
+    Vector<std::unique_ptr<int>> v;
+    v.emplace_back(new int(1));
+    auto p = std::make_unique<int>(2);
+    v.push_back(std::move(p));
+    for (int i = 3; i <= 20; ++i) {
+        v.emplace_back(std::make_unique<int>(i));
+    }
+    EXPECT_EQ(p, nullptr);
+    EXPECT_EQ(v.size(), 20);
+    EXPECT_EQ(*v[0], 1);
+    EXPECT_EQ(*v[19], 20);
+
+    Vector<std::pair<int, std::string>> pairs;
+    auto& ref = pairs.emplace_back(1, "one");
+    EXPECT_EQ(ref.second, "one");
+}
+
+TEST_F(VectorTest, EmplaceInMiddle) {
+    Vector<std::unique_ptr<int>> v;
+    v.emplace_back(std::make_unique<int>(1));
+    v.emplace_back(std::make_unique<int>(3));
+    v.emplace(1, std::make_unique<int>(2));
+    v.emplace(0, std::make_unique<int>(0));
+    ASSERT_EQ(v.size(), 4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(*v[i], i);
+    }
+    EXPECT_THROW(v.emplace(10, nullptr), std::out_of_range);
+}
+
+TEST_F(VectorTest, AppendRange) {
+    std::list<int> source{4, 5, 6};
+    int_vec.append(source.begin(), source.end());
+    int_vec.append({7, 8});
+    EXPECT_EQ(int_vec, (Vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+    std::istringstream input("9 10 11");
+    int_vec.append(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    EXPECT_EQ(int_vec.size(), 11);
+    EXPECT_EQ(int_vec.back(), 11);
+}
+
+TEST_F(VectorTest, InsertRange) {
+    int_vec.insert(1, {10, 11});
+    EXPECT_EQ(int_vec, (Vector<int>{1, 10, 11, 2, 3}));
+
+    int_vec.insert(4, {20, 21, 22, 23});
+    EXPECT_EQ(int_vec, (Vector<int>{1, 10, 11, 2, 20, 21, 22, 23, 3}));
+
+    Vector<int> other{7, 8};
+    int_vec.insert(0, other.data(), other.data() + other.size());
+    EXPECT_EQ(int_vec, (Vector<int>{7, 8, 1, 10, 11, 2, 20, 21, 22, 23, 3}));
+
+    std::istringstream input("5 6");
+    int_vec.insert(2, std::istream_iterator<int>(input), std::istream_iterator<int>());
+    EXPECT_EQ(int_vec, (Vector<int>{7, 8, 5, 6, 1, 10, 11, 2, 20, 21, 22, 23, 3}));
+
+    Vector<std::string> strings{"a", "d"};
+    std::string middle[] = {"b", "c"};
+    strings.insert(1, std::begin(middle), std::end(middle));
+    EXPECT_EQ(strings, (Vector<std::string>{"a", "b", "c", "d"}));
+}
+
+TEST_F(VectorTest, TriviallyRelocatableDetection) {
+    EXPECT_TRUE(is_trivially_relocatable_v<int>);
+    EXPECT_TRUE(is_trivially_relocatable_v<Handle>);
+    EXPECT_FALSE(is_trivially_relocatable_v<std::string>);
+}
+
+TEST_F(VectorTest, RelocationSkipsMoveConstructor) {
+    Handle::moves = 0;
+    Vector<Handle> v;
+    for (int i = 0; i < 100; ++i) {
+        v.emplace_back(i);
+    }
+    v.emplace(0, -1);
+    v.erase(50);
+    v.shrink_to_fit();
+    EXPECT_EQ(Handle::moves, 1);
+    EXPECT_EQ(v.size(), 100);
+    EXPECT_EQ(*v[0].ptr, -1);
+    EXPECT_EQ(*v[49].ptr, 48);
+    EXPECT_EQ(*v[50].ptr, 50);
+    EXPECT_EQ(*v[99].ptr, 99);
+}
+
+TEST_F(VectorTest, RelocatableInsertRangeAndGrowth) {
+    Vector<int> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    int extra[] = {-1, -2, -3};
+    v.insert(500, std::begin(extra), std::end(extra));
+    EXPECT_EQ(v.size(), 1003);
+    EXPECT_EQ(v[499], 499);
+    EXPECT_EQ(v[500], -1);
+    EXPECT_EQ(v[502], -3);
+    EXPECT_EQ(v[503], 500);
+    EXPECT_EQ(v[1002], 999);
+}
+
+TEST_F(VectorTest, RelocatableInsertRollsBackOnThrow) {
+    Vector<ThrowingCopy> v;
+    for (int i = 0; i < 5; ++i) {
+        v.emplace_back(i);
+    }
+    ThrowingCopy bad[] = {ThrowingCopy(7), ThrowingCopy(-1)};
+    EXPECT_THROW(v.insert(2, std::begin(bad), std::end(bad)), std::runtime_error);
+    ASSERT_EQ(v.size(), 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(v[i].value, i);
+    }
+}
+
+// Тесты для SmallVector
+TEST_F(VectorTest, InsertCount) {
+    int_vec.insert(1, 3, 9);
+    EXPECT_EQ(int_vec, (Vector<int>{1, 9, 9, 9, 2, 3}));
+    int_vec.insert(6, 2, 0);
+    EXPECT_EQ(int_vec, (Vector<int>{1, 9, 9, 9, 2, 3, 0, 0}));
+    int_vec.insert(0, 0, 5);
+    EXPECT_EQ(int_vec.size(), 8);
+    int_vec.insert(0, 1, int_vec[1]);
+    EXPECT_EQ(int_vec.front(), 9);
+    EXPECT_THROW(int_vec.insert(20, 1, 0), std::out_of_range);
+
+    Vector<std::string> strings{"a", "b", "c"};
+    strings.insert(1, 1, "x");
+    strings.insert(1, 4, "y");
+    EXPECT_EQ(strings, (Vector<std::string>{"a", "y", "y", "y", "y", "x", "b", "c"}));
+}
+
+TEST_F(VectorTest, RangeErase) {
+    Vector<int> v{0, 1, 2, 3, 4, 5, 6};
+    v.erase(1, 4);
+    EXPECT_EQ(v, (Vector<int>{0, 4, 5, 6}));
+    v.erase(2, 2);
+    EXPECT_EQ(v.size(), 4);
+    v.erase(2, 4);
+    EXPECT_EQ(v, (Vector<int>{0, 4}));
+    EXPECT_THROW(v.erase(1, 3), std::out_of_range);
+    EXPECT_THROW(v.erase(2, 1), std::out_of_range);
+
+    Tracked::reset();
+    {
+        Vector<Tracked> tracked;
+        for (int i = 0; i < 10; ++i) {
+            tracked.emplace_back(i);
+        }
+        tracked.erase(2, 7);
+        ASSERT_EQ(tracked.size(), 5);
+        EXPECT_EQ(tracked[2].value, 7);
+    }
+    EXPECT_EQ(Tracked::constructed, Tracked::destroyed);
+}
+
+TEST_F(VectorTest, RemoveIf) {
+    Vector<int> v{1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_EQ(erase_if(v, [](int x) { return x % 3 == 0; }), 2);
+    EXPECT_EQ(v, (Vector<int>{1, 2, 4, 5, 7, 8}));
+    EXPECT_EQ(erase(v, 4), 1);
+    EXPECT_EQ(v, (Vector<int>{1, 2, 5, 7, 8}));
+
+    Vector<std::string> strings{"keep", "drop", "keep", "drop"};
+    EXPECT_EQ(strings.remove_if([](const std::string& s) { return s == "drop"; }), 2);
+    EXPECT_EQ(strings, (Vector<std::string>{"keep", "keep"}));
+
+    Vector<Handle> handles;
+    for (int i = 0; i < 6; ++i) {
+        handles.emplace_back(i);
+    }
+    Handle::moves = 0;
+    handles.remove_if([](const Handle& h) { return *h.ptr % 2 == 1; });
+    ASSERT_EQ(handles.size(), 3);
+    EXPECT_EQ(*handles[2].ptr, 4);
+    EXPECT_EQ(Handle::moves, 0);
+
+    int calls = 0;
+    EXPECT_THROW(handles.remove_if([&calls](const Handle& h) {
+        if (++calls == 2) throw std::runtime_error("predicate failed");
+        return *h.ptr == 0;
+    }), std::runtime_error);
+    ASSERT_EQ(handles.size(), 2);
+    EXPECT_EQ(*handles[0].ptr, 2);
+    EXPECT_EQ(*handles[1].ptr, 4);
+}
+
+TEST_F(VectorTest, SwapRemove) {
+    Vector<std::string> v{"a", "b", "c", "d"};
+    v.swap_remove(1);
+    EXPECT_EQ(v, (Vector<std::string>{"a", "d", "c"}));
+    v.swap_remove(2);
+    EXPECT_EQ(v, (Vector<std::string>{"a", "d"}));
+    EXPECT_THROW(v.swap_remove(2), std::out_of_range);
+
+    Vector<Handle> handles;
+    handles.emplace_back(1);
+    handles.emplace_back(2);
+    handles.emplace_back(3);
+    handles.swap_remove(0);
+    EXPECT_EQ(*handles[0].ptr, 3);
+    EXPECT_EQ(handles.size(), 2);
+}
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+    SmallVector<int, 4> v;
+    EXPECT_TRUE(v.is_small());
+    EXPECT_EQ(v.capacity(), 4);
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_TRUE(v.is_small());
+    v.push_back(4);
+    EXPECT_FALSE(v.is_small());
+    EXPECT_EQ(v.size(), 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(v[i], i);
+    }
+
+    v.resize(3);
+    v.shrink_to_fit();
+    EXPECT_TRUE(v.is_small());
+    EXPECT_EQ(v, (Vector<int>{0, 1, 2}));
+}
+
+TEST(SmallVectorTest, UsableThroughContainerInterface) {
+    SmallVector<std::string, 2> v{"a", "b"};
+    const Container<std::string>& c = v;
+    EXPECT_EQ(c.size(), 2);
+    EXPECT_FALSE(c.empty());
+
+    Vector<std::string> copy(v);
+    copy.insert(1, "x");
+    EXPECT_EQ(copy, (Vector<std::string>{"a", "x", "b"}));
+    EXPECT_EQ(v, (Vector<std::string>{"a", "b"}));
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+    SmallVector<std::string, 3> small{"one", "two"};
+    SmallVector<std::string, 3> big{"1", "2", "3", "4"};
+
+    SmallVector<std::string, 3> copy(small);
+    EXPECT_TRUE(copy.is_small());
+    EXPECT_EQ(copy, small);
+
+    SmallVector<std::string, 3> moved_small(std::move(small));
+    EXPECT_TRUE(moved_small.is_small());
+    EXPECT_EQ(moved_small, (Vector<std::string>{"one", "two"}));
+    EXPECT_TRUE(small.empty());
+    small.push_back("reuse");
+    EXPECT_TRUE(small.is_small());
+
+    const std::string* heap = big.data();
+    SmallVector<std::string, 3> moved_big(std::move(big));
+    EXPECT_EQ(moved_big.data(), heap);
+    EXPECT_TRUE(big.is_small());
+    EXPECT_TRUE(big.empty());
+
+    Vector<std::string> plain(std::move(moved_small));
+    EXPECT_EQ(plain, (Vector<std::string>{"one", "two"}));
+    EXPECT_TRUE(moved_small.empty());
+
+    copy = moved_big;
+    EXPECT_EQ(copy.size(), 4);
+    moved_big = std::move(copy);
+    EXPECT_EQ(moved_big.size(), 4);
+}
+
+TEST(SmallVectorTest, Swap) {
+    SmallVector<int, 2> a{1};
+    SmallVector<int, 2> b{2, 3, 4};
+    a.swap(b);
+    EXPECT_EQ(a, (Vector<int>{2, 3, 4}));
+    EXPECT_EQ(b, (Vector<int>{1}));
+    EXPECT_TRUE(b.is_small());
+
+    SmallVector<int, 2> c{5, 6};
+    b.swap(c);
+    EXPECT_EQ(b, (Vector<int>{5, 6}));
+    EXPECT_EQ(c, (Vector<int>{1}));
+    EXPECT_TRUE(b.is_small());
+    EXPECT_TRUE(c.is_small());
+}
+
+TEST(SmallVectorTest, ElementLifetimes) {
+    Tracked::reset();
+    {
+        SmallVector<Tracked, 3> v;
+        for (int i = 0; i < 10; ++i) {
+            v.emplace_back(i);
+        }
+        v.resize(2);
+        v.shrink_to_fit();
+        SmallVector<Tracked, 3> other(std::move(v));
+        EXPECT_EQ(other[1].value, 1);
+    }
+    EXPECT_EQ(Tracked::constructed, Tracked::destroyed);
+}
+
+TEST(VectorAllocatorTest, CustomAllocatorSeesAllStorage) {
+    CountingAllocator<std::string> alloc;
+    {
+        Vector<std::string, CountingAllocator<std::string>> v(alloc);
+        for (int i = 0; i < 100; ++i) {
+            v.push_back(std::to_string(i));
+        }
+        EXPECT_EQ(*alloc.live, static_cast<long>(v.capacity()));
+
+        Vector<std::string, CountingAllocator<std::string>> other;
+        other.push_back("x");
+        other = std::move(v);
+        EXPECT_EQ(other.get_allocator(), alloc);
+        EXPECT_EQ(other[99], "99");
+    }
+    EXPECT_EQ(*alloc.live, 0);
+}
+
+TEST(VectorAllocatorTest, PmrVectorUsesMonotonicArena) {
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    pmr::Vector<int> v(&arena);
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.get_allocator().resource(), &arena);
+    EXPECT_EQ(v.data()[99], 99);
+    auto* first = reinterpret_cast<unsigned char*>(v.data());
+    EXPECT_TRUE(first >= buffer && first < buffer + sizeof(buffer));
+
+    // Different resources never share storage: the elements are moved instead.
+    pmr::Vector<int> heap;
+    heap = std::move(v);
+    EXPECT_EQ(heap.size(), 100);
+    EXPECT_EQ(heap.get_allocator().resource(), std::pmr::get_default_resource());
+    EXPECT_TRUE(v.empty());
+
+    pmr::SmallVector<std::pmr::string, 2> strings(&arena);
+    strings.emplace_back("a fairly long string that will not fit into SSO");
+    EXPECT_EQ(strings[0].get_allocator().resource(), &arena);
+}
+
+TEST(VectorGrowthTest, Policies) {
+    Vector<int> doubling;
+    Vector<int, std::allocator<int>, GoldenGrowth> golden;
+    Vector<int, std::allocator<int>, PageGrowth> paged;
+    for (int i = 0; i < 17; ++i) {
+        doubling.push_back(i);
+        golden.push_back(i);
+        paged.push_back(i);
+    }
+    EXPECT_EQ(doubling.capacity(), 32);
+    EXPECT_EQ(golden.capacity(), 24);
+    EXPECT_EQ(paged.capacity(), 24);
+
+    EXPECT_EQ(GoldenGrowth::next_capacity(100, 101, sizeof(int)), 150);
+    EXPECT_EQ(DoublingGrowth::next_capacity(100, 500, sizeof(int)), 500);
+    EXPECT_EQ(PageGrowth::next_capacity(3, 4, 6), 5);
+    EXPECT_EQ(PageGrowth::next_capacity(1000, 1001, 8) * 8 % PageGrowth::page_size, 0);
+    EXPECT_GE(PageGrowth::next_capacity(1000, 1001, 8), 1500);
+
+    golden.append({1, 2, 3, 4, 5, 6, 7, 8});
+    EXPECT_EQ(golden.capacity(), 36);
+}
+
+TEST(MappedVectorTest, GrowsWithoutRelocating) {
+    MappedVector<long> v(MappedAllocator<long>(size_t(1) << 30, true));
+    v.push_back(0);
+    const long* first = v.data();
+    for (long i = 1; i < 1'000'000; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.data(), first);
+    EXPECT_EQ(v[999'999], 999'999);
+    EXPECT_TRUE(v.get_allocator().huge_pages());
+
+    v.reserve(v.get_allocator().max_size());
+    EXPECT_EQ(v.data(), first);
+    EXPECT_THROW(v.reserve(v.get_allocator().max_size() + 1), std::bad_array_new_length);
+}
+
+TEST(MappedVectorTest, ElementLifetimes) {
+    Tracked::reset();
+    {
+        MappedVector<Tracked> v(MappedAllocator<Tracked>(1 << 20));
+        for (int i = 0; i < 10'000; ++i) {
+            v.emplace_back(i);
+        }
+        MappedVector<Tracked> copy(v);
+        EXPECT_EQ(copy[9'999].value, 9'999);
+        v.erase(0);
+        v.shrink_to_fit();
+        EXPECT_EQ(v.front().value, 1);
+    }
+    EXPECT_EQ(Tracked::constructed, Tracked::destroyed);
+}
+
+struct ArmedMove {
+    static inline bool armed = false;
+    int value;
+
+    ArmedMove(int v) : value(v) {}
+    ArmedMove(const ArmedMove& other) : value(other.value) {
+        if (armed) throw std::runtime_error("copy");
+    }
+    ArmedMove(ArmedMove&& other) : value(other.value) {
+        if (armed) throw std::runtime_error("move");
+    }
+    ArmedMove& operator=(const ArmedMove&) = default;
+    ArmedMove& operator=(ArmedMove&&) = default;
+};
+
+TEST(SmallVectorTest, MoveNoexceptMatchesWhatCanThrow) {
+    static_assert(std::is_nothrow_move_constructible_v<SmallVector<int, 4>>);
+    static_assert(std::is_nothrow_move_assignable_v<SmallVector<std::string, 4>>);
+    static_assert(!std::is_nothrow_move_constructible_v<SmallVector<ArmedMove, 4>>);
+    static_assert(std::is_nothrow_move_constructible_v<Vector<ArmedMove>>);
+    static_assert(std::is_nothrow_move_assignable_v<Vector<std::string>>);
+    static_assert(!std::is_convertible_v<SmallVector<int, 4>, Vector<int>>);
+
+    SmallVector<ArmedMove, 2> small{1};
+    SmallVector<ArmedMove, 2> spilled{2, 3, 4};
+    ArmedMove::armed = true;
+    EXPECT_THROW(small.swap(spilled), std::runtime_error);
+    EXPECT_THROW(Vector<ArmedMove>(std::move(small)), std::runtime_error);
+    ArmedMove::armed = false;
+    ASSERT_EQ(spilled.size(), 3);
+    EXPECT_EQ(spilled[1].value, 3);
+    ASSERT_EQ(small.size(), 1);
+    EXPECT_EQ(small[0].value, 1);
+}
+
+TEST(NestedVectorTest, RelocatesOnGrowth) {
+    Vector<Vector<int>> nested;
+    for (int i = 0; i < 100; ++i) {
+        nested.push_back(Vector<int>{i, i + 1});
+    }
+    SmallVector<int, 4> small{7, 8};
+    nested.push_back(Vector<int>(std::move(small)));
+    ASSERT_EQ(nested.size(), 101);
+    EXPECT_EQ(nested[50], (Vector<int>{50, 51}));
+    EXPECT_EQ(nested[100], (Vector<int>{7, 8}));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
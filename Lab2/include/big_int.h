@@ -2,19 +2,129 @@
 #define BIG_INT_H
 
 #include <complex>
+#include <cstddef>
 #include <iostream>
+#include <new>
+#include <span>
 #include <vector>
 #include <string>
 #include <bits/stdint-uintn.h>
 
 #define BASE 1000000000
 
+class BigIntArena {
+private:
+    struct alignas(std::max_align_t) Chunk {
+        Chunk* next;
+        std::size_t size;
+        std::size_t used;
+    };
+
+    Chunk* chunks = nullptr;
+    std::size_t chunk_size;
+    std::size_t total = 0;
+
+    static thread_local BigIntArena* active;
+
+    Chunk* add_chunk(std::size_t min_bytes);
+
+public:
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    explicit BigIntArena(std::size_t chunk_bytes = DEFAULT_CHUNK_SIZE);
+    BigIntArena(const BigIntArena&) = delete;
+    BigIntArena& operator=(const BigIntArena&) = delete;
+    ~BigIntArena();
+
+    void* allocate(std::size_t bytes, std::size_t align);
+    void deallocate(void* p, std::size_t bytes) noexcept;
+    void release() noexcept;
+
+    [[nodiscard]] std::size_t bytes_allocated() const { return total; }
+
+    static BigIntArena* current() noexcept { return active; }
+
+    class Scope {
+    private:
+        BigIntArena* previous;
+
+    public:
+        explicit Scope(BigIntArena& arena) : previous(active) {
+            active = &arena;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            active = previous;
+        }
+    };
+};
+
+template<typename T>
+class LimbAllocator {
+private:
+    BigIntArena* arena;
+
+    template<typename U>
+    friend class LimbAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    LimbAllocator() noexcept : arena(BigIntArena::current()) {}
+
+    template<typename U>
+    LimbAllocator(const LimbAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(std::size_t n) {
+        if (arena) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (arena) {
+            arena->deallocate(p, n * sizeof(T));
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    [[nodiscard]] LimbAllocator select_on_container_copy_construction() const {
+        return LimbAllocator();
+    }
+
+    template<typename U>
+    bool operator==(const LimbAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+};
+
+using limb_vector = std::vector<unsigned long long, LimbAllocator<unsigned long long>>;
+
+class BigIntBits;
+
 class BigInt {
 private:
-    std::vector<unsigned long long> digits;
+    limb_vector digits;
     bool isNegative;
     void remove_leading_zeros();
-    [[nodiscard]] BigInt shift_left(size_t m) const;
+    [[nodiscard]] bool is_zero() const;
+    void mul_small(unsigned long long m);
+    unsigned long long divmod_small(unsigned long long d);
+    [[nodiscard]] unsigned long long mod_small(unsigned long long d) const;
+    static void divmod_abs(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder);
+
+    void add_small(unsigned long long value);
+    static void accumulate_product(BigInt& acc, const BigInt& a, const BigInt& b, bool negate);
+
+    friend class ModContext;
+    friend class BigIntBits;
     static void split_at(const BigInt& num, size_t m, BigInt& high, BigInt& low) ;
 
 public:
@@ -50,8 +160,33 @@ public:
     BigInt operator%(const BigInt& other) const;
     [[nodiscard]] BigInt abs() const;
 
+    [[nodiscard]] BigInt shift_left(size_t m) const;
+    [[nodiscard]] BigInt shift_right(size_t m) const;
+
+    BigInt operator<<(size_t bits) const;
+    BigInt operator>>(size_t bits) const;
+    BigInt& operator<<=(size_t bits);
+    BigInt& operator>>=(size_t bits);
+
+    BigInt operator&(const BigInt& other) const;
+    BigInt operator|(const BigInt& other) const;
+    BigInt operator^(const BigInt& other) const;
+    BigInt operator~() const;
+
+    [[nodiscard]] BigIntBits bits() const;
+    [[nodiscard]] size_t bit_length() const;
+    [[nodiscard]] size_t popcount() const;
+
     [[nodiscard]] BigInt mod_exp(const BigInt& exp, const BigInt& mod) const;
 
+    [[nodiscard]] BigInt pow(uint64_t exp) const;
+    [[nodiscard]] BigInt isqrt() const;
+    [[nodiscard]] BigInt iroot(uint64_t n) const;
+    [[nodiscard]] bool is_perfect_power() const;
+
+    [[nodiscard]] bool is_probable_prime(unsigned rounds = 8) const;
+    [[nodiscard]] BigInt next_prime(unsigned threads = 0) const;
+
     void fft(std::vector<std::complex<long double>>& a, bool invert);
 
     BigInt multFurie(const BigInt &second);
@@ -62,8 +197,64 @@ public:
     [[nodiscard]] BigInt newton_divide(const BigInt& a) const;
 
 
+    friend void addmul(BigInt& acc, const BigInt& a, const BigInt& b);
+    friend void submul(BigInt& acc, const BigInt& a, const BigInt& b);
+    friend BigInt dot(std::span<const BigInt> a, std::span<const BigInt> b);
+
     friend std::istream& operator>>(std::istream& is, BigInt& num);
     friend std::ostream& operator<<(std::ostream& os, const BigInt& num);
 };
 
+void addmul(BigInt& acc, const BigInt& a, const BigInt& b);
+void submul(BigInt& acc, const BigInt& a, const BigInt& b);
+BigInt dot(std::span<const BigInt> a, std::span<const BigInt> b);
+
+class BigIntBits {
+private:
+    std::vector<uint32_t> words;
+    bool negative = false;
+
+public:
+    explicit BigIntBits(const BigInt& value);
+    BigIntBits(std::vector<uint32_t> magnitude, bool is_negative);
+
+    [[nodiscard]] BigInt to_big_int() const;
+
+    [[nodiscard]] bool test_bit(std::size_t i) const {
+        return i / 32 < words.size() && ((words[i / 32] >> (i % 32)) & 1);
+    }
+
+    [[nodiscard]] std::size_t bit_length() const;
+    [[nodiscard]] std::size_t popcount() const;
+    [[nodiscard]] bool is_negative() const { return negative; }
+    [[nodiscard]] const std::vector<uint32_t>& limbs() const { return words; }
+};
+
+class ModContext {
+private:
+    BigInt mod;
+    BigInt odd_part;
+    std::size_t twos = 0;
+    limb_vector r2;
+    limb_vector one;
+    limb_vector minus_one;
+    unsigned long long inv = 0;
+
+    [[nodiscard]] limb_vector reduce(limb_vector t) const;
+    [[nodiscard]] limb_vector mont_mul(const limb_vector& a, const limb_vector& b) const;
+    [[nodiscard]] limb_vector to_mont(const BigInt& a) const;
+    [[nodiscard]] BigInt from_mont(const limb_vector& a) const;
+    [[nodiscard]] limb_vector mont_pow(const limb_vector& base, const BigInt& exp) const;
+
+    friend class BigInt;
+
+public:
+    explicit ModContext(const BigInt& modulus);
+
+    [[nodiscard]] const BigInt& modulus() const { return mod; }
+    [[nodiscard]] BigInt mul(const BigInt& a, const BigInt& b) const;
+    [[nodiscard]] BigInt pow(const BigInt& base, const BigInt& exp) const;
+    [[nodiscard]] bool strong_probable_prime(const BigInt& base) const;
+};
+
 #endif
\ No newline at end of file
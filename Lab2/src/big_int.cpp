@@ -3,12 +3,72 @@
 #include <complex>
 #include <cmath>
 #include <cstdint>
+#include <atomic>
+#include <bit>
 #include <iomanip>
+#include <limits>
+#include <random>
 #include <string>
+#include <thread>
 
 using ll = long long;
 using ull = unsigned long long;
 
+thread_local BigIntArena* BigIntArena::active = nullptr;
+
+BigIntArena::BigIntArena(std::size_t chunk_bytes) : chunk_size(chunk_bytes) {}
+
+BigIntArena::~BigIntArena() {
+    release();
+}
+
+BigIntArena::Chunk* BigIntArena::add_chunk(std::size_t min_bytes) {
+    std::size_t size = std::max(chunk_size, min_bytes);
+    void* memory = ::operator new(sizeof(Chunk) + size);
+    Chunk* chunk = static_cast<Chunk*>(memory);
+    chunk->next = chunks;
+    chunk->size = size;
+    chunk->used = 0;
+    chunks = chunk;
+    return chunk;
+}
+
+void* BigIntArena::allocate(std::size_t bytes, std::size_t align) {
+    Chunk* chunk = chunks;
+    if (chunk) {
+        std::size_t offset = (chunk->used + align - 1) & ~(align - 1);
+        if (offset + bytes <= chunk->size) {
+            chunk->used = offset + bytes;
+            total += bytes;
+            return reinterpret_cast<char*>(chunk + 1) + offset;
+        }
+    }
+    chunk = add_chunk(bytes + align);
+    chunk->used = bytes;
+    total += bytes;
+    return chunk + 1;
+}
+
+void BigIntArena::deallocate(void* p, std::size_t bytes) noexcept {
+    if (!chunks) {
+        return;
+    }
+    char* top = reinterpret_cast<char*>(chunks + 1) + chunks->used;
+    if (static_cast<char*>(p) + bytes == top) {
+        chunks->used -= bytes;
+        total -= bytes;
+    }
+}
+
+void BigIntArena::release() noexcept {
+    while (chunks) {
+        Chunk* next = chunks->next;
+        ::operator delete(chunks);
+        chunks = next;
+    }
+    total = 0;
+}
+
 std::size_t num_length(uint64_t num) {
     std::size_t length = 0;
     while (num) {
@@ -170,6 +230,52 @@ void BigInt::remove_leading_zeros() {
     }
 }
 
+bool BigInt::is_zero() const {
+    return digits.size() == 1 && digits[0] == 0;
+}
+
+void BigInt::mul_small(ull m) {
+    ull carry = 0;
+    for (auto& digit : digits) {
+        ull cur = digit * m + carry;
+        digit = cur % BASE;
+        carry = cur / BASE;
+    }
+    while (carry) {
+        digits.push_back(carry % BASE);
+        carry /= BASE;
+    }
+    remove_leading_zeros();
+    if (is_zero()) {
+        isNegative = false;
+    }
+}
+
+ull BigInt::divmod_small(ull d) {
+    ull rem = 0;
+    for (size_t i = digits.size(); i-- > 0;) {
+        ull cur = digits[i] + rem * BASE;
+        digits[i] = cur / d;
+        rem = cur % d;
+    }
+    remove_leading_zeros();
+    if (is_zero()) {
+        isNegative = false;
+    }
+    return rem;
+}
+
+void BigInt::add_small(ull value) {
+    for (size_t i = 0; value; ++i) {
+        if (i == digits.size()) {
+            digits.push_back(0);
+        }
+        ull cur = digits[i] + value;
+        digits[i] = cur % BASE;
+        value = cur / BASE;
+    }
+}
+
 BigInt BigInt::abs() const {
     BigInt temp = BigInt(*this);
     temp.isNegative = false;
@@ -263,43 +369,96 @@ BigInt BigInt::operator*(const BigInt& other) const {
     return result;
 }
 
-BigInt BigInt::operator/(const BigInt& other) const {
-    if (other == BigInt(0)) {
-        throw std::invalid_argument("Division by zero");
-    }
+void BigInt::divmod_abs(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder) {
+    const limb_vector& u = a.digits;
+    const limb_vector& v = b.digits;
+    size_t n = v.size();
 
-    BigInt abs_other = other.abs();
-    if (abs() < abs_other) {
-        return BigInt(0);
+    quotient = BigInt();
+    remainder = BigInt();
+    if (u.size() < n) {
+        remainder.digits = u;
+        return;
+    }
+    if (n == 1) {
+        remainder = a.abs();
+        ull rem = remainder.divmod_small(v[0]);
+        quotient = std::move(remainder);
+        remainder = BigInt(static_cast<long long>(rem));
+        return;
     }
 
-    BigInt result, current;
-    result.isNegative = isNegative != other.isNegative;
-    result.digits.resize(digits.size(), 0);
+    size_t m = u.size() - n;
+    ull d = BASE / (v.back() + 1);
 
-    for (int i = digits.size() - 1; i >= 0; --i) {
-        current.digits.insert(current.digits.begin(), digits[i]);
-        current.remove_leading_zeros();
-
-        ull l = 0, r = BASE;
-        while (l < r) {
-            ull m = (l + r + 1) / 2;
-            BigInt product = abs_other * BigInt(m);
-            if (product <= current) {
-                l = m;
-            } else {
-                r = m - 1;
+    limb_vector un(u.size() + 1, 0);
+    limb_vector vn(n, 0);
+    ull carry = 0;
+    for (size_t i = 0; i < u.size(); ++i) {
+        ull cur = u[i] * d + carry;
+        un[i] = cur % BASE;
+        carry = cur / BASE;
+    }
+    un[u.size()] = carry;
+    carry = 0;
+    for (size_t i = 0; i < n; ++i) {
+        ull cur = v[i] * d + carry;
+        vn[i] = cur % BASE;
+        carry = cur / BASE;
+    }
+
+    quotient.digits.assign(m + 1, 0);
+    for (size_t j = m + 1; j-- > 0;) {
+        ull num = un[j + n] * BASE + un[j + n - 1];
+        ull qhat = num / vn[n - 1];
+        ull rhat = num % vn[n - 1];
+        while (qhat >= BASE || qhat * vn[n - 2] > rhat * BASE + un[j + n - 2]) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= BASE) {
+                break;
             }
         }
 
-        result.digits[i] = l;
-        current -= abs_other * BigInt(l);
+        ll borrow = 0;
+        carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            ull p = qhat * vn[i] + carry;
+            carry = p / BASE;
+            ll t = static_cast<ll>(un[i + j]) - static_cast<ll>(p % BASE) - borrow;
+            borrow = t < 0;
+            un[i + j] = t < 0 ? t + BASE : t;
+        }
+        ll top = static_cast<ll>(un[j + n]) - static_cast<ll>(carry) - borrow;
+
+        if (top < 0) {
+            --qhat;
+            carry = 0;
+            for (size_t i = 0; i < n; ++i) {
+                ull sum = un[i + j] + vn[i] + carry;
+                carry = sum / BASE;
+                un[i + j] = sum % BASE;
+            }
+            top += static_cast<ll>(carry);
+        }
+        un[j + n] = top;
+        quotient.digits[j] = qhat;
     }
 
-    result.remove_leading_zeros();
-    if (result.digits.size() == 1 && result.digits[0] == 0) {
-        result.isNegative = false;
+    remainder.digits.assign(un.begin(), un.begin() + n);
+    remainder.remove_leading_zeros();
+    remainder.divmod_small(d);
+    quotient.remove_leading_zeros();
+}
+
+BigInt BigInt::operator/(const BigInt& other) const {
+    if (other.is_zero()) {
+        throw std::invalid_argument("Division by zero");
     }
+
+    BigInt result, rem;
+    divmod_abs(*this, other, result, rem);
+    result.isNegative = !result.is_zero() && isNegative != other.isNegative;
     return result;
 }
 
@@ -335,12 +494,25 @@ BigInt BigInt::operator--() {
 
 BigInt BigInt::operator%(const BigInt& other) const {
     if (*this >= other) {
-        BigInt res = *this - (*this / other) * other;
+        if (other.is_zero()) {
+            throw std::invalid_argument("Division by zero");
+        }
+        BigInt quot, res;
+        divmod_abs(*this, other, quot, res);
+        res.isNegative = !res.is_zero() && isNegative;
         return res;
     }
     return *this;
 }
 
+ull BigInt::mod_small(ull d) const {
+    ull rem = 0;
+    for (size_t i = digits.size(); i-- > 0;) {
+        rem = (digits[i] + rem * BASE) % d;
+    }
+    return rem;
+}
+
 BigInt BigInt::mod_exp(const BigInt& exp, const BigInt& mod) const {
     if (exp < BigInt(2)) {
         if (exp == BigInt(1)) {
@@ -348,14 +520,127 @@ BigInt BigInt::mod_exp(const BigInt& exp, const BigInt& mod) const {
         }
         return BigInt(1);
     }
-    BigInt res = mod_exp(exp / BigInt(2), mod);
-    res = (res * res) % mod;
-    if (exp.digits[0] % 2 == 1) {
-        res = (res * *this) % mod;
+    if (!mod.isNegative && mod > BigInt(1) && mod.digits[0] % 2 == 1 && mod.digits[0] % 5 != 0) {
+        return ModContext(mod).pow(*this, exp);
+    }
+    BigIntBits exp_bits = exp.bits();
+    BigInt base = *this % mod;
+    BigInt res(1);
+    for (size_t i = exp_bits.bit_length(); i-- > 0;) {
+        res = (res * res) % mod;
+        if (exp_bits.test_bit(i)) {
+            res = (res * base) % mod;
+        }
     }
     return res;
 }
 
+BigInt BigInt::pow(uint64_t exp) const {
+    BigInt result(1);
+    BigInt base(*this);
+    while (exp) {
+        if (exp & 1) {
+            result = result.karatsuba_multiply(base);
+        }
+        exp >>= 1;
+        if (exp) {
+            base = base.karatsuba_multiply(base);
+        }
+    }
+    return result;
+}
+
+BigInt BigInt::isqrt() const {
+    return iroot(2);
+}
+
+BigInt BigInt::iroot(uint64_t n) const {
+    if (n == 0) {
+        throw std::invalid_argument("Zeroth root");
+    }
+    if (isNegative) {
+        if (n % 2 == 0) {
+            throw std::invalid_argument("Even root of negative number");
+        }
+        BigInt root = abs().iroot(n);
+        root.isNegative = !root.is_zero();
+        return root;
+    }
+    if (n == 1 || *this <= BigInt(1)) {
+        return *this;
+    }
+    if (n >= 30 * digits.size()) {
+        return BigInt(1);
+    }
+
+    long double lead = digits.back();
+    if (digits.size() > 1) lead += digits[digits.size() - 2] / 1e9L;
+    if (digits.size() > 2) lead += digits[digits.size() - 3] / 1e18L;
+    long double log10_root = (std::log10(lead) + 9.0L * (digits.size() - 1)) / n;
+
+    uint64_t exp10 = 0;
+    if (log10_root > 15) {
+        exp10 = static_cast<uint64_t>(log10_root) - 15;
+    }
+    long double mantissa = std::pow(10.0L, log10_root - exp10) * (1 + 1e-9L);
+    BigInt x(static_cast<long long>(std::ceil(mantissa)) + 1);
+    if (exp10) {
+        ull scale = 1;
+        for (uint64_t i = 0; i < exp10 % 9; ++i) {
+            scale *= 10;
+        }
+        x.mul_small(scale);
+        x = x.shift_left(exp10 / 9);
+    }
+
+    while (true) {
+        BigInt y = x;
+        y.mul_small(n - 1);
+        y += *this / x.pow(n - 1);
+        y.divmod_small(n);
+        if (y >= x) {
+            break;
+        }
+        x = std::move(y);
+    }
+
+    while (x.pow(n) > *this) {
+        --x;
+    }
+    while ((x + BigInt(1)).pow(n) <= *this) {
+        ++x;
+    }
+    return x;
+}
+
+bool BigInt::is_perfect_power() const {
+    BigInt a = abs();
+    if (a <= BigInt(1)) {
+        return true;
+    }
+    uint64_t max_exp = 30 * a.digits.size();
+    for (uint64_t k = 2; k <= max_exp; ++k) {
+        bool prime = true;
+        for (uint64_t p = 2; p * p <= k; ++p) {
+            if (k % p == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (!prime || (isNegative && k % 2 == 0)) {
+            continue;
+        }
+        BigInt root = a.iroot(k);
+        if (root < BigInt(2)) {
+            break;
+        }
+        if (root.pow(k) == a) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void BigInt::split_at(const BigInt& num, size_t m, BigInt& high, BigInt& low) {
     if (m >= num.digits.size()) {
         high = BigInt(0);
@@ -371,15 +656,202 @@ void BigInt::split_at(const BigInt& num, size_t m, BigInt& high, BigInt& low) {
 }
 
 BigInt BigInt::shift_left(size_t m) const {
-    if (*this == BigInt(0)) {
+    if (is_zero() || m == 0) {
         return *this;
     }
 
+    BigInt result;
+    result.isNegative = isNegative;
+    result.digits.reserve(digits.size() + m);
+    result.digits.assign(m, 0);
+    result.digits.insert(result.digits.end(), digits.begin(), digits.end());
+    return result;
+}
+
+BigInt BigInt::shift_right(size_t m) const {
+    if (m >= digits.size()) {
+        return BigInt(0);
+    }
+
+    BigInt result;
+    result.isNegative = isNegative;
+    result.digits.assign(digits.begin() + m, digits.end());
+    result.remove_leading_zeros();
+    if (result.is_zero()) {
+        result.isNegative = false;
+    }
+    return result;
+}
+
+// One mul_small/divmod_small pass handles shifts below 29 bits (2^29 * BASE still fits in a
+// limb product). Longer shifts build 2^bits once by squaring and apply it in a single
+// multiplication or division.
+static constexpr size_t SMALL_SHIFT = 29;
+
+BigInt& BigInt::operator<<=(size_t bits) {
+    if (is_zero() || bits == 0) {
+        return *this;
+    }
+    if (bits < SMALL_SHIFT) {
+        mul_small(1ULL << bits);
+    } else {
+        *this = karatsuba_multiply(BigInt(2).pow(bits));
+    }
+    return *this;
+}
+
+BigInt& BigInt::operator>>=(size_t bits) {
+    if (is_zero() || bits == 0) {
+        return *this;
+    }
+    bool negative = isNegative;
+    bool inexact;
+    if (bits < SMALL_SHIFT) {
+        inexact = divmod_small(1ULL << bits) != 0;
+    } else if (bits >= 30 * digits.size()) {
+        // |*this| < BASE^size < 2^(30 * size), so every bit is shifted out.
+        digits.assign(1, 0);
+        inexact = true;
+    } else {
+        BigInt quotient, remainder;
+        divmod_abs(*this, BigInt(2).pow(bits), quotient, remainder);
+        inexact = !remainder.is_zero();
+        digits = std::move(quotient.digits);
+    }
+    // Arithmetic shift rounds towards negative infinity.
+    if (negative && inexact) {
+        add_small(1);
+    }
+    isNegative = negative && !is_zero();
+    return *this;
+}
+
+BigInt BigInt::operator<<(size_t bits) const {
     BigInt result(*this);
-    result.digits.insert(result.digits.begin(), m, 0);
+    result <<= bits;
     return result;
 }
 
+BigInt BigInt::operator>>(size_t bits) const {
+    BigInt result(*this);
+    result >>= bits;
+    return result;
+}
+
+static std::vector<uint32_t> twos_complement(const BigIntBits& value, size_t len) {
+    std::vector<uint32_t> words = value.limbs();
+    words.resize(len, 0);
+    if (value.is_negative()) {
+        for (auto& word : words) {
+            if (word-- != 0) {
+                break;
+            }
+        }
+        for (auto& word : words) {
+            word = ~word;
+        }
+    }
+    return words;
+}
+
+template<typename Op>
+static BigInt bitwise(const BigInt& lhs, const BigInt& rhs, Op op) {
+    BigIntBits a = lhs.bits();
+    BigIntBits b = rhs.bits();
+    size_t len = std::max(a.limbs().size(), b.limbs().size()) + 1;
+    std::vector<uint32_t> x = twos_complement(a, len);
+    std::vector<uint32_t> y = twos_complement(b, len);
+
+    std::vector<uint32_t> words(len);
+    for (size_t i = 0; i < len; ++i) {
+        words[i] = op(x[i], y[i]);
+    }
+    bool negative = op(a.is_negative() ? ~0u : 0u, b.is_negative() ? ~0u : 0u) != 0;
+    if (negative) {
+        for (auto& word : words) {
+            word = ~word;
+        }
+        for (auto& word : words) {
+            if (++word != 0) {
+                break;
+            }
+        }
+    }
+    return BigIntBits(std::move(words), negative).to_big_int();
+}
+
+BigInt BigInt::operator&(const BigInt& other) const {
+    return bitwise(*this, other, [](uint32_t a, uint32_t b) { return a & b; });
+}
+
+BigInt BigInt::operator|(const BigInt& other) const {
+    return bitwise(*this, other, [](uint32_t a, uint32_t b) { return a | b; });
+}
+
+BigInt BigInt::operator^(const BigInt& other) const {
+    return bitwise(*this, other, [](uint32_t a, uint32_t b) { return a ^ b; });
+}
+
+BigInt BigInt::operator~() const {
+    BigInt result = *this + BigInt(1);
+    result.isNegative = !result.isNegative && !result.is_zero();
+    return result;
+}
+
+BigIntBits BigInt::bits() const {
+    return BigIntBits(*this);
+}
+
+size_t BigInt::bit_length() const {
+    return bits().bit_length();
+}
+
+size_t BigInt::popcount() const {
+    return bits().popcount();
+}
+
+BigIntBits::BigIntBits(const BigInt& value) : negative(value.isNegative) {
+    BigInt magnitude = value.abs();
+    while (!magnitude.is_zero()) {
+        words.push_back(static_cast<uint32_t>(magnitude.divmod_small(1ULL << 32)));
+    }
+}
+
+BigIntBits::BigIntBits(std::vector<uint32_t> magnitude, bool is_negative)
+    : words(std::move(magnitude)), negative(is_negative) {
+    while (!words.empty() && words.back() == 0) {
+        words.pop_back();
+    }
+    if (words.empty()) {
+        negative = false;
+    }
+}
+
+BigInt BigIntBits::to_big_int() const {
+    BigInt result;
+    for (size_t i = words.size(); i-- > 0;) {
+        result.mul_small(1ULL << 32);
+        result.add_small(words[i]);
+    }
+    result.isNegative = negative && !result.is_zero();
+    return result;
+}
+
+size_t BigIntBits::bit_length() const {
+    if (words.empty()) {
+        return 0;
+    }
+    return 32 * (words.size() - 1) + std::bit_width(words.back());
+}
+
+size_t BigIntBits::popcount() const {
+    size_t count = 0;
+    for (uint32_t word : words) {
+        count += std::popcount(word);
+    }
+    return count;
+}
+
 BigInt BigInt::karatsuba_multiply(const BigInt& other) const {
     if (digits.size() <= 10 || other.digits.size() <= 10) {
         return *this * other;
@@ -408,6 +880,128 @@ BigInt BigInt::karatsuba_multiply(const BigInt& other) const {
     return result;
 }
 
+void BigInt::accumulate_product(BigInt& acc, const BigInt& a, const BigInt& b, bool negate) {
+    if (a.is_zero() || b.is_zero()) {
+        return;
+    }
+    if (&acc == &a || &acc == &b) {
+        // acc is written while the rows are read, so the aliased operand has to be a copy.
+        BigInt copy(acc);
+        accumulate_product(acc, &acc == &a ? copy : a, &acc == &b ? copy : b, negate);
+        return;
+    }
+    if (a.digits.size() > 10 && b.digits.size() > 10) {
+        // Large operands multiply faster with Karatsuba; the product is then folded in as a single row.
+        accumulate_product(acc, a.karatsuba_multiply(b), BigInt(1), negate);
+        return;
+    }
+
+    bool negative = (a.isNegative != b.isNegative) != negate;
+    bool subtract = !acc.is_zero() && acc.isNegative != negative;
+    if (!subtract) {
+        acc.isNegative = negative;
+    }
+    size_t size = std::max(acc.digits.size(), a.digits.size() + b.digits.size()) + 1;
+    acc.digits.resize(size, 0);
+    bool underflow = false;
+    for (size_t i = 0; i < a.digits.size(); ++i) {
+        ull carry = 0;
+        size_t k = i;
+        if (!subtract) {
+            for (size_t j = 0; j < b.digits.size(); ++j, ++k) {
+                ull cur = acc.digits[k] + a.digits[i] * b.digits[j] + carry;
+                acc.digits[k] = cur % BASE;
+                carry = cur / BASE;
+            }
+            for (; carry; ++k) {
+                ull cur = acc.digits[k] + carry;
+                acc.digits[k] = cur % BASE;
+                carry = cur / BASE;
+            }
+            continue;
+        }
+        ull borrow = 0;
+        for (size_t j = 0; j < b.digits.size(); ++j, ++k) {
+            ull cur = a.digits[i] * b.digits[j] + carry;
+            carry = cur / BASE;
+            ull sub = cur % BASE + borrow;
+            borrow = acc.digits[k] < sub;
+            acc.digits[k] = acc.digits[k] + (borrow ? BASE : 0) - sub;
+        }
+        for (; (carry || borrow) && k < size; ++k) {
+            ull sub = carry + borrow;
+            carry = 0;
+            borrow = acc.digits[k] < sub;
+            acc.digits[k] = acc.digits[k] + (borrow ? BASE : 0) - sub;
+        }
+        underflow |= borrow != 0;
+    }
+    if (underflow) {
+        // The product outweighed acc, which now holds BASE^size minus the result's magnitude.
+        for (auto& limb : acc.digits) {
+            limb = BASE - 1 - limb;
+        }
+        acc.add_small(1);
+        acc.isNegative = !acc.isNegative;
+    }
+    acc.remove_leading_zeros();
+    if (acc.is_zero()) {
+        acc.isNegative = false;
+    }
+}
+
+void addmul(BigInt& acc, const BigInt& a, const BigInt& b) {
+    BigInt::accumulate_product(acc, a, b, false);
+}
+
+void submul(BigInt& acc, const BigInt& a, const BigInt& b) {
+    BigInt::accumulate_product(acc, a, b, true);
+}
+
+BigInt dot(std::span<const BigInt> a, std::span<const BigInt> b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot: operand lengths differ");
+    }
+
+    size_t size = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        size = std::max(size, a[i].digits.size() + b[i].digits.size());
+    }
+    size += 4;
+
+    const ull limit = 16000000000000000000ULL;
+    limb_vector sums[2] = {limb_vector(size, 0), limb_vector(size, 0)};
+    for (size_t t = 0; t < a.size(); ++t) {
+        const limb_vector& x = a[t].digits;
+        const limb_vector& y = b[t].digits;
+        limb_vector& acc = sums[a[t].isNegative != b[t].isNegative];
+        for (size_t i = 0; i < x.size(); ++i) {
+            for (size_t j = 0; j < y.size(); ++j) {
+                size_t k = i + j;
+                acc[k] += x[i] * y[j];
+                while (acc[k] >= limit) {
+                    acc[k + 1] += acc[k] / BASE;
+                    acc[k] %= BASE;
+                    ++k;
+                }
+            }
+        }
+    }
+
+    BigInt parts[2];
+    for (int s = 0; s < 2; ++s) {
+        ull carry = 0;
+        for (auto& limb : sums[s]) {
+            ull cur = limb + carry;
+            limb = cur % BASE;
+            carry = cur / BASE;
+        }
+        parts[s].digits = std::move(sums[s]);
+        parts[s].remove_leading_zeros();
+    }
+    return parts[0] - parts[1];
+}
+
 void BigInt::fft(std::vector<std::complex<long double>>& a, bool invert) {
     size_t n = a.size();
     if (n <= 1) return;
@@ -460,7 +1054,7 @@ BigInt BigInt::multFurie(const BigInt& other) {
     fft(fa, true);
 
     unsigned long long carry = 0;
-    std::vector<unsigned long long> temp_digits;
+    limb_vector temp_digits;
 
     for (auto& x : fa) {
         long double val = x.real();
@@ -490,4 +1084,280 @@ BigInt BigInt::multFurie(const BigInt& other) {
 
     result.digits = std::move(temp_digits);
     return result;
-}
\ No newline at end of file
+}
+
+static const std::vector<unsigned>& small_primes() {
+    static const std::vector<unsigned> primes = [] {
+        const unsigned limit = 2000;
+        std::vector<bool> composite(limit + 1, false);
+        std::vector<unsigned> result;
+        for (unsigned i = 2; i <= limit; ++i) {
+            if (composite[i]) continue;
+            result.push_back(i);
+            for (unsigned j = i * i; j <= limit; j += i) {
+                composite[j] = true;
+            }
+        }
+        return result;
+    }();
+    return primes;
+}
+
+bool BigInt::is_probable_prime(unsigned rounds) const {
+    if (isNegative || *this < BigInt(2)) {
+        return false;
+    }
+    const auto& primes = small_primes();
+    for (unsigned p : primes) {
+        if (mod_small(p) == 0) {
+            return *this == BigInt(p);
+        }
+    }
+    ull limit = static_cast<ull>(primes.back()) * primes.back();
+    if (digits.size() <= 2 && *this < BigInt(static_cast<long long>(limit))) {
+        return true;
+    }
+
+    ModContext ctx(*this);
+    for (unsigned p : primes) {
+        if (p > 37) break;
+        if (!ctx.strong_probable_prime(BigInt(p))) {
+            return false;
+        }
+    }
+
+    std::mt19937_64 gen(digits[0]);
+    BigInt range = *this - BigInt(3);
+    for (unsigned i = 0; i < rounds; ++i) {
+        BigInt base(static_cast<long long>(gen() % 1000000000000000000ULL));
+        base = base % range + BigInt(2);
+        if (!ctx.strong_probable_prime(base)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BigInt BigInt::next_prime(unsigned threads) const {
+    if (*this < BigInt(2)) {
+        return BigInt(2);
+    }
+    BigInt candidate = *this + BigInt(1);
+    if (candidate.digits[0] % 2 == 0) {
+        ++candidate;
+    }
+
+    const auto& primes = small_primes();
+    if (candidate <= BigInt(primes.back())) {
+        while (!candidate.is_probable_prime()) {
+            candidate += BigInt(2);
+        }
+        return candidate;
+    }
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<unsigned> residues(primes.size());
+    for (size_t i = 0; i < primes.size(); ++i) {
+        residues[i] = candidate.mod_small(primes[i]);
+    }
+
+    // The workers start once and claim odd offsets from one shared cursor. Each sieves its
+    // offset against the residue table and tests the survivors. best only ever shrinks, and
+    // every offset below it has been claimed, so a worker quits once its next offset passes it.
+    std::atomic<ull> cursor{0};
+    std::atomic<ull> best{std::numeric_limits<ull>::max()};
+    auto worker = [&] {
+        for (ull delta = cursor.fetch_add(2); delta < best.load(); delta = cursor.fetch_add(2)) {
+            bool survives = true;
+            for (size_t i = 1; i < primes.size(); ++i) {
+                if ((residues[i] + delta) % primes[i] == 0) {
+                    survives = false;
+                    break;
+                }
+            }
+            if (!survives) {
+                continue;
+            }
+            BigInt n = candidate + BigInt(static_cast<long long>(delta));
+            if (n.is_probable_prime()) {
+                ull current = best.load();
+                while (delta < current && !best.compare_exchange_weak(current, delta)) {
+                }
+            }
+        }
+    };
+
+    if (threads == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back(worker);
+        }
+        for (auto& thread : pool) {
+            thread.join();
+        }
+    }
+    return candidate + BigInt(static_cast<long long>(best.load()));
+}
+
+ModContext::ModContext(const BigInt& modulus) : mod(modulus) {
+    if (mod.isNegative || mod <= BigInt(1) || mod.digits[0] % 2 == 0 || mod.digits[0] % 5 == 0) {
+        throw std::invalid_argument("Modulus must be greater than 1 and coprime to the limb base");
+    }
+    size_t k = mod.digits.size();
+
+    ll r0 = BASE, r1 = static_cast<ll>(mod.digits[0]);
+    ll t0 = 0, t1 = 1;
+    while (r1 != 0) {
+        ll q = r0 / r1;
+        std::swap(r0, r1);
+        r1 -= q * r0;
+        std::swap(t0, t1);
+        t1 -= q * t0;
+    }
+    ull m_inv = static_cast<ull>((t0 % BASE + BASE) % BASE);
+    inv = (BASE - m_inv) % BASE;
+
+    one = (BigInt(1).shift_left(k) % mod).digits;
+    one.resize(k, 0);
+    r2 = (BigInt(1).shift_left(2 * k) % mod).digits;
+    r2.resize(k, 0);
+    minus_one = (mod - BigInt(1)).digits;
+    minus_one.resize(k, 0);
+    minus_one = mont_mul(minus_one, r2);
+
+    odd_part = mod - BigInt(1);
+    while (odd_part.digits[0] % 2 == 0) {
+        odd_part.divmod_small(2);
+        ++twos;
+    }
+}
+
+limb_vector ModContext::reduce(limb_vector t) const {
+    const limb_vector& m = mod.digits;
+    size_t k = m.size();
+    for (size_t i = 0; i < k; ++i) {
+        ull u = t[i] * inv % BASE;
+        ull carry = 0;
+        for (size_t j = 0; j < k; ++j) {
+            ull cur = t[i + j] + u * m[j] + carry;
+            t[i + j] = cur % BASE;
+            carry = cur / BASE;
+        }
+        for (size_t idx = i + k; carry; ++idx) {
+            ull cur = t[idx] + carry;
+            t[idx] = cur % BASE;
+            carry = cur / BASE;
+        }
+    }
+
+    limb_vector result(t.begin() + k, t.begin() + 2 * k + 1);
+    bool geq = result[k] != 0;
+    if (!geq) {
+        geq = true;
+        for (size_t i = k; i-- > 0;) {
+            if (result[i] != m[i]) {
+                geq = result[i] > m[i];
+                break;
+            }
+        }
+    }
+    if (geq) {
+        ll borrow = 0;
+        for (size_t i = 0; i <= k; ++i) {
+            ll diff = static_cast<ll>(result[i]) - borrow - (i < k ? static_cast<ll>(m[i]) : 0);
+            borrow = diff < 0;
+            result[i] = diff < 0 ? diff + BASE : diff;
+        }
+    }
+    result.resize(k);
+    return result;
+}
+
+limb_vector ModContext::mont_mul(const limb_vector& a, const limb_vector& b) const {
+    size_t k = mod.digits.size();
+    limb_vector t(2 * k + 1, 0);
+    for (size_t i = 0; i < k; ++i) {
+        ull carry = 0;
+        for (size_t j = 0; j < k; ++j) {
+            ull cur = t[i + j] + a[i] * b[j] + carry;
+            t[i + j] = cur % BASE;
+            carry = cur / BASE;
+        }
+        t[i + k] = carry;
+    }
+    return reduce(std::move(t));
+}
+
+limb_vector ModContext::to_mont(const BigInt& a) const {
+    BigInt quot, rem;
+    BigInt::divmod_abs(a, mod, quot, rem);
+    if (a.isNegative && !rem.is_zero()) {
+        rem = mod - rem;
+    }
+    limb_vector limbs = rem.digits;
+    limbs.resize(mod.digits.size(), 0);
+    return mont_mul(limbs, r2);
+}
+
+BigInt ModContext::from_mont(const limb_vector& a) const {
+    limb_vector t(a);
+    t.resize(2 * mod.digits.size() + 1, 0);
+    BigInt result;
+    result.digits = reduce(std::move(t));
+    result.remove_leading_zeros();
+    return result;
+}
+
+limb_vector ModContext::mont_pow(const limb_vector& base, const BigInt& exp) const {
+    BigIntBits exp_bits = exp.bits();
+    size_t length = exp_bits.bit_length();
+    if (length == 0) {
+        return one;
+    }
+
+    limb_vector result = base;
+    for (size_t i = length - 1; i-- > 0;) {
+        result = mont_mul(result, result);
+        if (exp_bits.test_bit(i)) {
+            result = mont_mul(result, base);
+        }
+    }
+    return result;
+}
+
+BigInt ModContext::mul(const BigInt& a, const BigInt& b) const {
+    return from_mont(mont_mul(to_mont(a), to_mont(b)));
+}
+
+BigInt ModContext::pow(const BigInt& base, const BigInt& exp) const {
+    if (exp.isNegative) {
+        throw std::invalid_argument("Negative exponent");
+    }
+    return from_mont(mont_pow(to_mont(base), exp));
+}
+
+bool ModContext::strong_probable_prime(const BigInt& base) const {
+    limb_vector b = to_mont(base);
+    if (std::all_of(b.begin(), b.end(), [](ull limb) { return limb == 0; })) {
+        return true;
+    }
+    limb_vector x = mont_pow(b, odd_part);
+    if (x == one || x == minus_one) {
+        return true;
+    }
+    for (size_t i = 1; i < twos; ++i) {
+        x = mont_mul(x, x);
+        if (x == minus_one) {
+            return true;
+        }
+        if (x == one) {
+            return false;
+        }
+    }
+    return false;
+}
@@ -258,6 +258,276 @@ TEST(FurieTest, multFurie2) {
     EXPECT_EQ(multFurie_result, BigInt("37358383570383923042439837069931124234930192162309024405728049392171435551838411321293920182073243100906028436395515312933754872883286391064126248540093112447894021939657894633447620177109925"));
 }
 
+// Тесты для арены разрядов
+TEST(ArenaTest, LimbsComeFromActiveArena) {
+    BigIntArena arena;
+    {
+        BigIntArena::Scope scope(arena);
+        BigInt num1("123456789012345678901234567890");
+        BigInt num2("987654321098765432109876543210");
+        BigInt product = num1 * num2;
+        EXPECT_EQ(product, BigInt("121932631137021795226185032733622923332237463801111263526900"));
+        EXPECT_GT(arena.bytes_allocated(), 0u);
+    }
+    EXPECT_EQ(BigIntArena::current(), nullptr);
+}
+
+TEST(ArenaTest, ResultEscapesScopeByCopy) {
+    BigIntArena arena;
+    BigInt result;
+    {
+        BigIntArena::Scope scope(arena);
+        BigInt num("99999999999999999999");
+        result = num + BigInt(1);
+    }
+    arena.release();
+    EXPECT_EQ(arena.bytes_allocated(), 0u);
+    EXPECT_EQ(result, BigInt("100000000000000000000"));
+}
+
+TEST(ArenaTest, NestedScopes) {
+    BigIntArena outer;
+    BigIntArena inner;
+    BigIntArena::Scope outer_scope(outer);
+    {
+        BigIntArena::Scope inner_scope(inner);
+        EXPECT_EQ(BigIntArena::current(), &inner);
+    }
+    EXPECT_EQ(BigIntArena::current(), &outer);
+}
+
+// Тесты для возведения в степень и извлечения корней
+TEST(PowerTest, Pow) {
+    EXPECT_EQ(BigInt(2).pow(100), BigInt("1267650600228229401496703205376"));
+    EXPECT_EQ(BigInt(-3).pow(5), BigInt(-243));
+    EXPECT_EQ(BigInt(-3).pow(4), BigInt(81));
+    EXPECT_EQ(BigInt(12345).pow(0), BigInt(1));
+    EXPECT_EQ(BigInt(0).pow(7), BigInt(0));
+}
+
+TEST(PowerTest, Isqrt) {
+    EXPECT_EQ(BigInt(0).isqrt(), BigInt(0));
+    EXPECT_EQ(BigInt(15).isqrt(), BigInt(3));
+    EXPECT_EQ(BigInt(16).isqrt(), BigInt(4));
+    BigInt big("12345678901234567890123456789012345678901234567890");
+    BigInt root = big.isqrt();
+    EXPECT_EQ(root, BigInt("3513641828820144253111222"));
+    EXPECT_TRUE(root * root <= big);
+    EXPECT_TRUE((root + BigInt(1)) * (root + BigInt(1)) > big);
+    EXPECT_THROW(BigInt(-4).isqrt(), std::invalid_argument);
+}
+
+TEST(PowerTest, Iroot) {
+    BigInt cube = BigInt("123456789123456789").pow(3);
+    EXPECT_EQ(cube.iroot(3), BigInt("123456789123456789"));
+    EXPECT_EQ((cube - BigInt(1)).iroot(3), BigInt("123456789123456788"));
+    EXPECT_EQ(BigInt(-27).iroot(3), BigInt(-3));
+    EXPECT_EQ(BigInt(2).pow(200).iroot(199), BigInt(2));
+    EXPECT_EQ(BigInt(1000).iroot(64), BigInt(1));
+    EXPECT_THROW(BigInt(10).iroot(0), std::invalid_argument);
+}
+
+TEST(PowerTest, IsPerfectPower) {
+    EXPECT_TRUE(BigInt(1).is_perfect_power());
+    EXPECT_TRUE(BigInt(64).is_perfect_power());
+    EXPECT_TRUE(BigInt(-125).is_perfect_power());
+    EXPECT_TRUE(BigInt("7").pow(41).is_perfect_power());
+    EXPECT_FALSE(BigInt(-16).is_perfect_power());
+    EXPECT_FALSE(BigInt(72).is_perfect_power());
+    EXPECT_FALSE((BigInt(2).pow(127) - BigInt(1)).is_perfect_power());
+}
+
+// Тесты для деления и модульной арифметики
+TEST(DivisionTest, LargeOperands) {
+    BigInt a("123456789012345678901234567890123456789012345678901234567890");
+    BigInt b("987654321098765432109876543210");
+    EXPECT_EQ(a / b, BigInt("124999998860937500014238281249"));
+    EXPECT_EQ(a % b, BigInt("935329860093532986009353298600"));
+    EXPECT_EQ((a / b) * b + a % b, a);
+    EXPECT_EQ(BigInt("-1000000000000000000000") / BigInt("1000000000001"), BigInt("-999999999"));
+}
+
+TEST(ModContextTest, MulAndPow) {
+    BigInt mod("1000000000000000000000000000057");
+    ModContext ctx(mod);
+    BigInt a("123456789012345678901234567890");
+    BigInt b("987654321098765432109876543210");
+    EXPECT_EQ(ctx.mul(a, b), (a * b) % mod);
+    EXPECT_EQ(ctx.pow(a, BigInt(65537)), a.mod_exp(BigInt(65537), mod));
+    EXPECT_EQ(ctx.pow(BigInt(-2), BigInt(3)), mod - BigInt(8));
+    EXPECT_THROW(ModContext(BigInt(1000)), std::invalid_argument);
+}
+
+TEST(ModularExponentiationTest, ModExpLarge) {
+    BigInt mod("170141183460469231731687303715884105727");
+    EXPECT_EQ(BigInt(3).mod_exp(mod - BigInt(1), mod), BigInt(1));
+    EXPECT_EQ(BigInt(7).mod_exp(BigInt(13), BigInt(100)), BigInt(7).pow(13) % BigInt(100));
+}
+
+// Тесты для проверки простоты
+TEST(PrimalityTest, SmallNumbers) {
+    EXPECT_FALSE(BigInt(-7).is_probable_prime());
+    EXPECT_FALSE(BigInt(1).is_probable_prime());
+    EXPECT_TRUE(BigInt(2).is_probable_prime());
+    EXPECT_TRUE(BigInt(1999).is_probable_prime());
+    EXPECT_FALSE(BigInt(1001).is_probable_prime());
+    EXPECT_TRUE(BigInt(3999971).is_probable_prime());
+}
+
+TEST(PrimalityTest, LargeNumbers) {
+    EXPECT_TRUE(BigInt("170141183460469231731687303715884105727").is_probable_prime());
+    EXPECT_FALSE(BigInt("3825123056546413051").is_probable_prime());
+    EXPECT_FALSE(BigInt("318665857834031151167461").is_probable_prime());
+    BigInt p("1000000000000000000000000000057");
+    EXPECT_FALSE((p * BigInt("1000000000000000000000000000099")).is_probable_prime());
+}
+
+TEST(PrimalityTest, NextPrime) {
+    EXPECT_EQ(BigInt(0).next_prime(), BigInt(2));
+    EXPECT_EQ(BigInt(13).next_prime(), BigInt(17));
+    EXPECT_EQ(BigInt("1000000000000000000000000000000").next_prime(4),
+              BigInt("1000000000000000000000000000057"));
+    EXPECT_EQ(BigInt("1000000000000000000000000000000").next_prime(1),
+              BigInt("1000000000000000000000000000057"));
+}
+
+// Тесты для битовых операций и сдвигов
+TEST(BitwiseTest, AndOrXor) {
+    BigInt a("123456789012345678901234567890");
+    BigInt b("-987654321098765432109876543210");
+
+    EXPECT_EQ(a & b, BigInt("121512828827855409466171785234"));
+    EXPECT_EQ(a | b, BigInt("-985710360914275162674813760554"));
+    EXPECT_EQ(a ^ b, BigInt("-1107223189742130572140985545788"));
+    EXPECT_EQ(b & (BigInt(0) - b), BigInt(2));
+    EXPECT_EQ(~a, BigInt("-123456789012345678901234567891"));
+    EXPECT_EQ(~BigInt(-1), BigInt(0));
+}
+
+TEST(BitwiseTest, Shifts) {
+    BigInt a("123456789012345678901234567890");
+    BigInt b("-987654321098765432109876543210");
+
+    EXPECT_EQ(a << 100, BigInt("156500072693749876333549759454926973536814597484617284976640"));
+    EXPECT_EQ((a << 100) >> 100, a);
+    EXPECT_EQ((BigInt(0) - a) >> 7, BigInt("-964506164158950616415895062"));
+    EXPECT_EQ(b >> 200, BigInt(-1));
+    EXPECT_EQ(BigInt(-1) >> 5, BigInt(-1));
+    EXPECT_EQ(BigInt(1) << 0, BigInt(1));
+
+    BigInt c(5);
+    c <<= 3;
+    EXPECT_EQ(c, BigInt(40));
+    c >>= 4;
+    EXPECT_EQ(c, BigInt(2));
+}
+
+TEST(BitwiseTest, LongShifts) {
+    BigInt a("123456789012345678901234567890");
+    BigInt big = a << 5000;
+    EXPECT_EQ(big.bit_length(), 5097u);
+    EXPECT_EQ(big >> 4999, a * BigInt(2));
+    EXPECT_EQ(big, a * BigInt(2).pow(5000));
+    EXPECT_EQ(a >> 60, a / BigInt(2).pow(60));
+
+    BigInt negative = BigInt(0) - big - BigInt(1);
+    EXPECT_EQ(negative >> 5000, BigInt(0) - a - BigInt(1));
+    EXPECT_EQ((BigInt(0) - big) >> 5000, BigInt(0) - a);
+    EXPECT_EQ(BigInt(3) >> 64, BigInt(0));
+    EXPECT_EQ(BigInt(-3) >> 64, BigInt(-1));
+}
+
+TEST(BitwiseTest, BitAccess) {
+    BigInt a("123456789012345678901234567890");
+    EXPECT_EQ(a.popcount(), 54u);
+    EXPECT_EQ(a.bit_length(), 97u);
+    EXPECT_EQ(BigInt(0).bit_length(), 0u);
+
+    BigIntBits bits = BigInt(10).bits();
+    EXPECT_FALSE(bits.test_bit(0));
+    EXPECT_TRUE(bits.test_bit(1));
+    EXPECT_TRUE(bits.test_bit(3));
+    EXPECT_FALSE(bits.test_bit(1000));
+    EXPECT_EQ(bits.to_big_int(), BigInt(10));
+}
+
+TEST(BitwiseTest, LimbShifts) {
+    BigInt a("123456789012345678");
+    EXPECT_EQ(a.shift_left(2), BigInt("123456789012345678000000000000000000"));
+    EXPECT_EQ(a.shift_right(1), BigInt(123456789));
+    EXPECT_EQ(a.shift_right(5), BigInt(0));
+    EXPECT_EQ(BigInt(0).shift_left(3), BigInt(0));
+}
+
+// Тесты для накопления произведений
+TEST(FusedMultiplyTest, AddMulSubMul) {
+    BigInt a("123456789012345678901234567890");
+    BigInt b("-987654321098765432109876543210");
+    BigInt acc("1000000000000000000000");
+
+    addmul(acc, a, a);
+    EXPECT_EQ(acc, BigInt("1000000000000000000000") + a * a);
+
+    addmul(acc, a, b);
+    EXPECT_EQ(acc, BigInt("1000000000000000000000") + a * a + a * b);
+
+    submul(acc, a, b);
+    EXPECT_EQ(acc, BigInt("1000000000000000000000") + a * a);
+
+    BigInt self(12345);
+    addmul(self, self, self);
+    EXPECT_EQ(self, BigInt(12345 + 12345LL * 12345));
+
+    BigInt zero;
+    submul(zero, a, a);
+    EXPECT_EQ(zero, BigInt(0) - a * a);
+}
+
+TEST(FusedMultiplyTest, MixedSignsCrossZero) {
+    BigInt a("123456789012345678901234567890");
+    BigInt b("-987654321098765432109876543210");
+    std::vector<BigInt> starts = {BigInt(1), BigInt("-5"), a * b + BigInt(1), BigInt(0) - a * b,
+                                  BigInt("999999999999999999999999999999999999999999999999999999999999")};
+    for (const BigInt& start : starts) {
+        BigInt acc = start;
+        addmul(acc, a, b);
+        EXPECT_EQ(acc, start + a * b);
+        acc = start;
+        submul(acc, a, b);
+        EXPECT_EQ(acc, start - a * b);
+    }
+
+    BigInt acc = a * b;
+    addmul(acc, b, a);
+    submul(acc, a, b);
+    submul(acc, a, b);
+    EXPECT_EQ(acc, BigInt(0));
+    std::ostringstream out;
+    out << acc;
+    EXPECT_EQ(out.str(), "0");
+
+    BigInt big = BigInt("999999999999999999999999999").pow(12);
+    BigInt total = big;
+    submul(total, big, BigInt(2));
+    EXPECT_EQ(total, BigInt(0) - big);
+    submul(total, big, big);
+    EXPECT_EQ(total, BigInt(0) - big - big * big);
+}
+
+TEST(FusedMultiplyTest, Dot) {
+    std::vector<BigInt> x;
+    std::vector<BigInt> y;
+    BigInt expected;
+    for (int i = 0; i < 50; ++i) {
+        x.push_back(BigInt("999999999999999999999999999").pow(i % 4 + 1) * BigInt(i % 3 == 0 ? -1 : 1));
+        y.push_back(BigInt("999999999999999999").pow(i % 3 + 1));
+        expected += x.back() * y.back();
+    }
+    EXPECT_EQ(dot(x, y), expected);
+    EXPECT_EQ(dot(std::span<const BigInt>(), std::span<const BigInt>()), BigInt(0));
+    EXPECT_THROW(dot(std::span<const BigInt>(x).first(2), std::span<const BigInt>(y).first(3)), std::invalid_argument);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();